@@ -0,0 +1,271 @@
+#include "AOCUtilities.hpp"
+#include "CpuDispatch.hpp"
+
+#ifdef _WIN32
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+MappedInput::MappedInput(const std::string& filename, const LineIndex lineIndex) {
+    const auto path = std::filesystem::path{ filename };
+    if (!exists(path)) {
+        throw std::runtime_error{ "The specified file does not exist. " };
+    }
+    map(path);
+    if (lineIndex == LineIndex::Build) {
+        indexLines();
+    }
+}
+
+MappedInput::MappedInput(MappedInput&& other) noexcept {
+    swap(other);
+}
+
+MappedInput& MappedInput::operator=(MappedInput&& other) noexcept {
+    if (this != &other) {
+        release();
+        swap(other);
+    }
+    return *this;
+}
+
+MappedInput::~MappedInput() {
+    release();
+}
+
+void MappedInput::release() {
+    mLines.clear();
+    mLines.shrink_to_fit();
+#ifdef _WIN32
+    if (mData != nullptr) {
+        UnmapViewOfFile(mData);
+    }
+    if (mMapping != nullptr) {
+        CloseHandle(mMapping);
+    }
+#else
+    if (mData != nullptr) {
+        munmap(const_cast<char*>(mData), mSize);
+    }
+#endif
+    mMapping = nullptr;
+    mData = nullptr;
+    mSize = 0;
+}
+
+void MappedInput::swap(MappedInput& other) noexcept {
+    std::swap(mData, other.mData);
+    std::swap(mSize, other.mSize);
+    std::swap(mLines, other.mLines);
+    std::swap(mMapping, other.mMapping);
+}
+
+void MappedInput::map(const std::filesystem::path& path) {
+#ifdef _WIN32
+    const auto file = CreateFileW(path.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING,
+                                  FILE_ATTRIBUTE_NORMAL | FILE_FLAG_SEQUENTIAL_SCAN, nullptr);
+    if (file == INVALID_HANDLE_VALUE) {
+        throw std::runtime_error{ "Unable to open file. " };
+    }
+    LARGE_INTEGER fileSize;
+    if (!GetFileSizeEx(file, &fileSize)) {
+        CloseHandle(file);
+        throw std::runtime_error{ "Unable to determine file size. " };
+    }
+    mSize = static_cast<std::size_t>(fileSize.QuadPart);
+    if (mSize == 0) {
+        // empty files cannot be mapped
+        CloseHandle(file);
+        return;
+    }
+    mMapping = CreateFileMappingW(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+    CloseHandle(file);
+    if (mMapping == nullptr) {
+        mSize = 0;
+        throw std::runtime_error{ "Unable to map file. " };
+    }
+    mData = static_cast<const char*>(MapViewOfFile(mMapping, FILE_MAP_READ, 0, 0, 0));
+    if (mData == nullptr) {
+        release();
+        throw std::runtime_error{ "Unable to map file. " };
+    }
+#else
+    const auto fileDescriptor = open(path.c_str(), O_RDONLY);
+    if (fileDescriptor < 0) {
+        throw std::runtime_error{ "Unable to open file. " };
+    }
+    struct stat fileStatus {};
+    if (fstat(fileDescriptor, &fileStatus) != 0) {
+        close(fileDescriptor);
+        throw std::runtime_error{ "Unable to determine file size. " };
+    }
+    const auto size = static_cast<std::size_t>(fileStatus.st_size);
+    if (size == 0) {
+        // empty files cannot be mapped
+        close(fileDescriptor);
+        return;
+    }
+    void* const address = mmap(nullptr, size, PROT_READ, MAP_PRIVATE, fileDescriptor, 0);
+    close(fileDescriptor);
+    if (address == MAP_FAILED) {
+        throw std::runtime_error{ "Unable to map file. " };
+    }
+    madvise(address, size, MADV_SEQUENTIAL);
+    mData = static_cast<const char*>(address);
+    mSize = size;
+#endif
+}
+
+void MappedInput::indexLines() {
+    mLines = splitLines(contents());
+}
+
+std::vector<std::string> readInput(const std::string& filename) {
+    const auto input = MappedInput{ filename };
+    std::vector<std::string> result;
+    result.reserve(input.lines().size());
+    for (const auto line : input.lines()) {
+        result.emplace_back(line);
+    }
+    return result;
+}
+
+std::vector<std::string_view> splitLines(std::string_view text) {
+    std::vector<std::string_view> result;
+    while (!text.empty()) {
+        const auto newline = findChar(text.data(), text.data() + text.size(), '\n');
+        const auto length = static_cast<std::size_t>(newline - text.data());
+        auto line = text.substr(0, length);
+        if (!line.empty() && line.back() == '\r') {
+            line.remove_suffix(1);
+        }
+        result.push_back(line);
+        text.remove_prefix(length == text.size() ? length : length + 1);
+    }
+    return result;
+}
+
+LineStream::LineStream(const std::string& filename, const std::size_t bufferSize)
+    : mFile{ std::fopen(filename.c_str(), "rb") },
+      mOwnsFile{ true },
+      mBuffer(bufferSize) {
+    if (mFile == nullptr) {
+        throw std::runtime_error{ "Unable to open file. " };
+    }
+    // the stream already does its own buffering
+    std::setvbuf(mFile, nullptr, _IONBF, 0);
+}
+
+LineStream::LineStream(std::FILE* const file, const std::size_t bufferSize)
+    : mFile{ file },
+      mOwnsFile{ false },
+      mBuffer(bufferSize) { }
+
+LineStream LineStream::fromStdin(const std::size_t bufferSize) {
+    return LineStream{ stdin, bufferSize };
+}
+
+LineStream::~LineStream() {
+    if (mOwnsFile && mFile != nullptr) {
+        std::fclose(mFile);
+    }
+}
+
+bool LineStream::readNextLine() {
+    while (true) {
+        const auto available = mBuffer.data() + mBegin;
+        const auto newline = findChar(available, mBuffer.data() + mEnd, '\n');
+        if (newline != mBuffer.data() + mEnd) {
+            emitLine(static_cast<std::size_t>(newline - available), 1);
+            return true;
+        }
+        if (mEndOfFile) {
+            if (mBegin == mEnd) {
+                return false;
+            }
+            emitLine(mEnd - mBegin, 0);
+            return true;
+        }
+        refill();
+    }
+}
+
+void LineStream::emitLine(const std::size_t length, const std::size_t terminatorLength) {
+    mCurrentLine = std::string_view{ mBuffer.data() + mBegin, length };
+    if (!mCurrentLine.empty() && mCurrentLine.back() == '\r') {
+        mCurrentLine.remove_suffix(1);
+    }
+    mBegin += length + terminatorLength;
+}
+
+void LineStream::refill() {
+    // move the incomplete line to the front of the buffer and fill up the rest
+    const auto remaining = mEnd - mBegin;
+    std::memmove(mBuffer.data(), mBuffer.data() + mBegin, remaining);
+    mBegin = 0;
+    mEnd = remaining;
+    if (mEnd == mBuffer.size()) {
+        mBuffer.resize(mBuffer.size() * 2);
+    }
+    const auto numRead = std::fread(mBuffer.data() + mEnd, 1, mBuffer.size() - mEnd, mFile);
+    if (numRead == 0) {
+        if (std::ferror(mFile)) {
+            throw std::runtime_error{ "Unable to read from file. " };
+        }
+        mEndOfFile = true;
+    }
+    mEnd += numRead;
+}
+
+namespace {
+    // the part of findChar() that is not vectorized
+    [[nodiscard]] const char* findCharTail(const char* first, const char* const last, const char needle) {
+#if defined(__SSE2__) || defined(_M_X64)
+        const auto needles16 = _mm_set1_epi8(needle);
+        while (last - first >= 16) {
+            const auto chunk = _mm_loadu_si128(reinterpret_cast<const __m128i*>(first));
+            const auto mask = static_cast<std::uint32_t>(_mm_movemask_epi8(_mm_cmpeq_epi8(chunk, needles16)));
+            if (mask != 0) {
+                return first + std::countr_zero(mask);
+            }
+            first += 16;
+        }
+#endif
+        while (first != last && *first != needle) {
+            ++first;
+        }
+        return first;
+    }
+
+#if AOC_SIMD_DISPATCH
+    AOC_TARGET_AVX2 const char* findCharAvx2(const char* first, const char* const last, const char needle) {
+        const auto needles32 = _mm256_set1_epi8(needle);
+        while (last - first >= 32) {
+            const auto chunk = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(first));
+            const auto mask = static_cast<std::uint32_t>(_mm256_movemask_epi8(_mm256_cmpeq_epi8(chunk, needles32)));
+            if (mask != 0) {
+                return first + std::countr_zero(mask);
+            }
+            first += 32;
+        }
+        return findCharTail(first, last, needle);
+    }
+#endif
+}// namespace
+
+const char* detail::findCharVectorized(const char* const first, const char* const last, const char needle) {
+#if AOC_SIMD_DISPATCH
+    static const auto kernel = selectKernel(KernelVariants<decltype(findCharTail)>{
+            .scalar = findCharTail, .avx2 = findCharAvx2 });
+#else
+    static const auto kernel = selectKernel(KernelVariants<decltype(findCharTail)>{ .scalar = findCharTail });
+#endif
+    return kernel(first, last, needle);
+}
@@ -0,0 +1,671 @@
+//
+// Created by coder2k on 06.12.2021.
+//
+
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <charconv>
+#include <concepts>
+#include <filesystem>
+#include <iterator>
+#include <limits>
+#include <numeric>
+#include <span>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <system_error>
+#include <type_traits>
+#include <utility>
+#include <vector>
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+
+#if defined(__SSE2__) || defined(_M_X64)
+#include <immintrin.h>
+#endif
+#if defined(_MSC_VER)
+#include <intrin.h>
+#endif
+
+using i8 = std::int8_t;
+using i16 = std::int16_t;
+using i32 = std::int32_t;
+using i64 = std::int64_t;
+using u8 = std::uint8_t;
+using u16 = std::uint16_t;
+using u32 = std::uint32_t;
+using u64 = std::uint64_t;
+using uz = std::size_t;
+
+/* Read-only memory mapping of an input file. The contents and all line views point directly
+ * into the mapping, so they stay valid until release() is called or the object is destroyed.
+ * Binary files are mapped with LineIndex::Skip, lines() is empty for them. */
+class MappedInput {
+public:
+    enum class LineIndex {
+        Build,
+        Skip,
+    };
+
+    MappedInput() = default;
+    explicit MappedInput(const std::string& filename, LineIndex lineIndex = LineIndex::Build);
+    MappedInput(const MappedInput&) = delete;
+    MappedInput& operator=(const MappedInput&) = delete;
+    MappedInput(MappedInput&& other) noexcept;
+    MappedInput& operator=(MappedInput&& other) noexcept;
+    ~MappedInput();
+
+    [[nodiscard]] std::string_view contents() const {
+        return std::string_view{ mData, mSize };
+    }
+
+    // every line without its line terminator (a final newline does not produce an empty last line)
+    [[nodiscard]] const std::vector<std::string_view>& lines() const {
+        return mLines;
+    }
+
+    [[nodiscard]] bool empty() const {
+        return mSize == 0;
+    }
+
+    // unmaps the file, all views handed out before become dangling
+    void release();
+
+private:
+    void swap(MappedInput& other) noexcept;
+    void map(const std::filesystem::path& path);
+    void indexLines();
+
+private:
+    const char* mData{ nullptr };
+    std::size_t mSize{ 0 };
+    std::vector<std::string_view> mLines;
+    void* mMapping{ nullptr };// only used on Windows
+};
+
+// compatibility wrapper that copies every line, prefer using MappedInput directly
+[[nodiscard]] std::vector<std::string> readInput(const std::string& filename);
+
+/* Views of every line of the given text without the line terminators. Unlike splitView(text, '\n'),
+ * empty lines are kept (a final newline does not produce an empty last line). */
+[[nodiscard]] std::vector<std::string_view> splitLines(std::string_view text);
+
+/* Reads a file (or stdin) lazily line by line through a fixed-size buffer. Every line view is only valid
+ * until the iterator is advanced, which keeps the memory footprint independent of the input size (the
+ * buffer only grows if a single line does not fit into it). */
+class LineStream {
+public:
+    static constexpr std::size_t defaultBufferSize = 64 * 1024;
+
+    class Iterator {
+    public:
+        using value_type = std::string_view;
+        using difference_type = std::ptrdiff_t;
+
+        Iterator() = default;
+
+        explicit Iterator(LineStream* stream) : mStream{ stream } {
+            ++(*this);
+        }
+
+        [[nodiscard]] std::string_view operator*() const {
+            return mStream->mCurrentLine;
+        }
+
+        Iterator& operator++() {
+            if (!mStream->readNextLine()) {
+                mStream = nullptr;
+            }
+            return *this;
+        }
+
+        void operator++(int) {
+            ++(*this);
+        }
+
+        [[nodiscard]] bool operator==(std::default_sentinel_t) const {
+            return mStream == nullptr;
+        }
+
+    private:
+        LineStream* mStream{ nullptr };
+    };
+
+    explicit LineStream(const std::string& filename, std::size_t bufferSize = defaultBufferSize);
+
+    [[nodiscard]] static LineStream fromStdin(std::size_t bufferSize = defaultBufferSize);
+
+    LineStream(const LineStream&) = delete;
+    LineStream& operator=(const LineStream&) = delete;
+    ~LineStream();
+
+    // a stream can only be iterated once
+    [[nodiscard]] Iterator begin() {
+        return Iterator{ this };
+    }
+
+    [[nodiscard]] std::default_sentinel_t end() const {
+        return std::default_sentinel;
+    }
+
+private:
+    LineStream(std::FILE* file, std::size_t bufferSize);
+
+    [[nodiscard]] bool readNextLine();
+    void emitLine(std::size_t length, std::size_t terminatorLength);
+    void refill();
+
+private:
+    std::FILE* mFile;
+    bool mOwnsFile;
+    std::vector<char> mBuffer;
+    std::size_t mBegin{ 0 };
+    std::size_t mEnd{ 0 };
+    bool mEndOfFile{ false };
+    std::string_view mCurrentLine;
+};
+
+[[nodiscard]] constexpr std::vector<std::string> split(const std::string& s, const char delimiter = ' ') {
+    std::string current;
+    std::vector<std::string> result;
+    for (char c : s) {
+        if (c == delimiter && !current.empty()) {
+            result.push_back(current);
+            current.clear();
+        } else {
+            current += c;
+        }
+    }
+    if (!current.empty()) {
+        result.push_back(current);
+    }
+    return result;
+}
+
+[[nodiscard]] constexpr std::string trim(const std::string& string, const char charToTrim = ' ') {
+    /* the bounds calculated describe the characters that should NOT be deleted, that's
+     * why they are exclusive in the context of the characters that SHOULD be deleted */
+    std::size_t leftBoundExclusive = 0;
+    std::size_t rightBoundExclusive = string.length() + 1;
+    for (std::size_t i = 0; i < string.length(); ++i) {
+        if (string[i] != charToTrim) {
+            leftBoundExclusive = i;
+            break;
+        }
+    }
+    auto index = string.length() - 1;
+    for (std::size_t i = 0; i < string.length(); ++i, --index) {
+        if (string[index] != charToTrim) {
+            rightBoundExclusive = index;
+            break;
+        }
+    }
+    // "   hallo  "
+    //  0123456789
+    // leftBoundExclusive = 3
+    // rightBoundExclusive = 7
+    const auto length = rightBoundExclusive - leftBoundExclusive + 1;
+    return string.substr(leftBoundExclusive, length);
+}
+
+namespace detail {
+    // findChar() for ranges of at least 32 characters, with AVX2 if the CPU has it (see CpuDispatch.hpp)
+    [[nodiscard]] const char* findCharVectorized(const char* first, const char* last, char needle);
+}// namespace detail
+
+// returns a pointer to the first occurrence of needle in [first, last) or last if there is none
+[[nodiscard]] constexpr const char* findChar(const char* first, const char* const last, const char needle) {
+    // the vectorized paths only run outside of constant evaluation, the loop at the end works in both
+    if !consteval {
+        // tokens are usually short, the inlined loops below avoid the call overhead of memchr for them,
+        // but the (unrolled) library implementation is faster for long ranges
+        if (last - first > 256) {
+            const auto result = std::memchr(first, needle, static_cast<std::size_t>(last - first));
+            return (result == nullptr ? last : static_cast<const char*>(result));
+        }
+        if (last - first >= 32) {
+            return detail::findCharVectorized(first, last, needle);
+        }
+#if defined(__SSE2__) || defined(_M_X64)
+        const auto needles16 = _mm_set1_epi8(needle);
+        while (last - first >= 16) {
+            const auto chunk = _mm_loadu_si128(reinterpret_cast<const __m128i*>(first));
+            const auto mask = static_cast<std::uint32_t>(_mm_movemask_epi8(_mm_cmpeq_epi8(chunk, needles16)));
+            if (mask != 0) {
+                return first + std::countr_zero(mask);
+            }
+            first += 16;
+        }
+#endif
+    }
+    while (first != last && *first != needle) {
+        ++first;
+    }
+    return first;
+}
+
+/* Lazy, allocation-free counterpart to split(). The tokens are views into the original string. Unlike
+ * split(), consecutive delimiters are treated as a single one, so no token contains a delimiter. Like the
+ * other string utilities below it is usable in constant expressions, e.g. on inputs embedded with the CMake
+ * function aoc_embed_input(). */
+class SplitView {
+public:
+    class Iterator {
+    public:
+        using value_type = std::string_view;
+        using difference_type = std::ptrdiff_t;
+
+        constexpr Iterator() = default;
+
+        constexpr Iterator(const std::string_view string, const char delimiter)
+            : mRemaining{ string },
+              mDelimiter{ delimiter } {
+            ++(*this);
+        }
+
+        [[nodiscard]] constexpr std::string_view operator*() const {
+            return mCurrent;
+        }
+
+        constexpr Iterator& operator++() {
+            while (!mRemaining.empty() && mRemaining.front() == mDelimiter) {
+                mRemaining.remove_prefix(1);
+            }
+            if (mRemaining.empty()) {
+                mFinished = true;
+                return *this;
+            }
+            const auto tokenEnd = findChar(mRemaining.data(), mRemaining.data() + mRemaining.size(), mDelimiter);
+            const auto length = static_cast<std::size_t>(tokenEnd - mRemaining.data());
+            mCurrent = mRemaining.substr(0, length);
+            mRemaining.remove_prefix(length);
+            return *this;
+        }
+
+        constexpr Iterator operator++(int) {
+            auto result = *this;
+            ++(*this);
+            return result;
+        }
+
+        [[nodiscard]] constexpr bool operator==(std::default_sentinel_t) const {
+            return mFinished;
+        }
+
+    private:
+        std::string_view mCurrent;
+        std::string_view mRemaining;
+        char mDelimiter{ ' ' };
+        bool mFinished{ false };
+    };
+
+    constexpr SplitView(const std::string_view string, const char delimiter)
+        : mString{ string },
+          mDelimiter{ delimiter } { }
+
+    [[nodiscard]] constexpr Iterator begin() const {
+        return Iterator{ mString, mDelimiter };
+    }
+
+    [[nodiscard]] constexpr std::default_sentinel_t end() const {
+        return std::default_sentinel;
+    }
+
+private:
+    std::string_view mString;
+    char mDelimiter;
+};
+
+[[nodiscard]] constexpr SplitView splitView(const std::string_view string, const char delimiter = ' ') {
+    return SplitView{ string, delimiter };
+}
+
+/* Writes the tokens of the string into the provided span and returns the total number of tokens. Tokens that
+ * don't fit into the span are counted but not stored. */
+constexpr std::size_t splitInto(const std::string_view string,
+                                const std::span<std::string_view> tokens,
+                                const char delimiter = ' ') {
+    auto count = std::size_t{ 0 };
+    for (const auto token : splitView(string, delimiter)) {
+        if (count < tokens.size()) {
+            tokens[count] = token;
+        }
+        ++count;
+    }
+    return count;
+}
+
+[[nodiscard]] constexpr std::string_view trimView(std::string_view string, const char charToTrim = ' ') {
+    const auto first = string.find_first_not_of(charToTrim);
+    if (first == std::string_view::npos) {
+        return std::string_view{};
+    }
+    string.remove_prefix(first);
+    string.remove_suffix(string.length() - 1 - string.find_last_not_of(charToTrim));
+    return string;
+}
+
+// number of consecutive decimal digits at the beginning of [first, last)
+[[nodiscard]] constexpr std::size_t digitRunLength(const char* const first, const char* const last) {
+#if defined(__SSE2__) || defined(_M_X64)
+    if !consteval {
+        if (last - first >= 16) {
+            const auto chunk = _mm_loadu_si128(reinterpret_cast<const __m128i*>(first));
+            const auto digits = _mm_and_si128(_mm_cmpgt_epi8(chunk, _mm_set1_epi8('0' - 1)),
+                                              _mm_cmplt_epi8(chunk, _mm_set1_epi8('9' + 1)));
+            const auto nonDigitMask = ~static_cast<std::uint32_t>(_mm_movemask_epi8(digits));
+            const auto length = static_cast<std::size_t>(std::countr_zero(nonDigitMask));
+            if (length < 16) {
+                return length;
+            }
+        }
+    }
+#endif
+    auto current = first;
+    while (current != last && *current >= '0' && *current <= '9') {
+        ++current;
+    }
+    return static_cast<std::size_t>(current - first);
+}
+
+/* Converts up to eight digits at once within a 64 bit register (SWAR). The caller has to guarantee that
+ * eight bytes are readable at first, even if length is smaller than that. */
+[[nodiscard]] inline std::uint64_t parseShortDigitRun(const char* const first, const std::size_t length) {
+    assert(length > 0 && length <= 8);
+    auto chunk = std::uint64_t{};
+    std::memcpy(&chunk, first, sizeof(chunk));
+    if constexpr (std::endian::native == std::endian::big) {
+        chunk = std::byteswap(chunk);
+    }
+    // subtracting '0' only borrows from the bytes after the digit run, which are shifted out afterwards
+    chunk -= 0x3030303030303030;
+    chunk <<= (8 - length) * 8;
+    chunk = (chunk * 10 + (chunk >> 8)) & 0x00FF00FF00FF00FF;
+    chunk = (chunk * 100 + (chunk >> 16)) & 0x0000FFFF0000FFFF;
+    chunk = (chunk * 10000 + (chunk >> 32)) & 0x00000000FFFFFFFF;
+    return chunk;
+}
+
+/* Parses the integer at the beginning of [first, last) and returns a pointer behind it (or nullptr if there
+ * is no integer). Short digit runs take the SWAR path, everything else is handled by std::from_chars. In
+ * constant expressions, where neither is available, the digits are accumulated one by one. */
+template<std::integral T>
+[[nodiscard]] constexpr const char* parseIntegerPrefix(const char* const first, const char* const last, T& value) {
+    auto digits = first;
+    auto negative = false;
+    if constexpr (std::is_signed_v<T>) {
+        if (digits != last && *digits == '-') {
+            negative = true;
+            ++digits;
+        }
+    }
+    const auto numDigits = digitRunLength(digits, last);
+    if (numDigits == 0) {
+        return nullptr;
+    }
+    if consteval {
+        using Unsigned = std::make_unsigned_t<T>;
+        const auto limit = static_cast<Unsigned>(static_cast<Unsigned>(std::numeric_limits<T>::max()) +
+                                                 (negative ? 1 : 0));
+        auto magnitude = Unsigned{ 0 };
+        for (auto digit = digits; digit != digits + numDigits; ++digit) {
+            const auto digitValue = static_cast<Unsigned>(*digit - '0');
+            if (magnitude > (limit - digitValue) / 10) {
+                throw std::runtime_error{ "Integer out of range. " };
+            }
+            magnitude = static_cast<Unsigned>(magnitude * 10 + digitValue);
+        }
+        value = static_cast<T>(negative ? static_cast<Unsigned>(Unsigned{ 0 } - magnitude) : magnitude);
+        return digits + numDigits;
+    }
+    if (numDigits <= 8 && last - digits >= 8) {
+        const auto magnitude = parseShortDigitRun(digits, numDigits);
+        const auto limit = static_cast<std::uint64_t>(std::numeric_limits<T>::max()) + (negative ? 1 : 0);
+        if (magnitude <= limit) {
+            value = static_cast<T>(negative ? static_cast<T>(0 - magnitude) : static_cast<T>(magnitude));
+            return digits + numDigits;
+        }
+    }
+    const auto [end, error] = std::from_chars(first, last, value);
+    if (error != std::errc{}) {
+        throw std::runtime_error{ "Integer out of range. " };
+    }
+    return end;
+}
+
+template<std::integral T>
+[[nodiscard]] constexpr T parseInteger(const std::string_view string) {
+    auto result = T{};
+    const auto end = parseIntegerPrefix(string.data(), string.data() + string.size(), result);
+    if (end != string.data() + string.size()) {
+        throw std::runtime_error{ "Unable to parse integer. " };
+    }
+    return result;
+}
+
+/* Calls the callback for every integer in the buffer. Integers can be separated by any characters that
+ * can't be part of an integer (commas, whitespace, arrows, ...). */
+template<std::integral T, typename Callback>
+constexpr void forEachInteger(const std::string_view buffer, Callback&& callback) {
+    auto current = buffer.data();
+    const auto last = buffer.data() + buffer.size();
+    while (current != last) {
+        const auto isStartOfInteger = (*current >= '0' && *current <= '9') ||
+                                      (std::is_signed_v<T> && *current == '-' && current + 1 != last &&
+                                       current[1] >= '0' && current[1] <= '9');
+        if (!isStartOfInteger) {
+            ++current;
+            continue;
+        }
+        auto value = T{};
+        current = parseIntegerPrefix(current, last, value);
+        callback(value);
+    }
+}
+
+/* Parses the integers of the buffer into the provided span and returns the total number of integers.
+ * Integers that don't fit into the span are counted but not stored. */
+template<std::integral T, std::size_t Extent>
+constexpr std::size_t parseIntegers(const std::string_view buffer, const std::span<T, Extent> output) {
+    auto count = std::size_t{ 0 };
+    forEachInteger<T>(buffer, [&](const T value) {
+        if (count < output.size()) {
+            output[count] = value;
+        }
+        ++count;
+    });
+    return count;
+}
+
+// appends all integers of the buffer to the vector and returns how many were appended
+template<std::integral T>
+constexpr std::size_t appendIntegers(const std::string_view buffer, std::vector<T>& output) {
+    const auto previousSize = output.size();
+    forEachInteger<T>(buffer, [&](const T value) { output.push_back(value); });
+    return output.size() - previousSize;
+}
+
+/* The integers of a buffer known at compile time as an array, Size being their number:
+ *
+ *     constexpr auto numbers = integerArray<int, parseIntegers(input, std::span<int>{})>(input); */
+template<std::integral T, std::size_t Size>
+[[nodiscard]] constexpr std::array<T, Size> integerArray(const std::string_view buffer) {
+    auto result = std::array<T, Size>{};
+    if (parseIntegers(buffer, std::span{ result }) != Size) {
+        throw std::runtime_error{ "Unexpected number of integers. " };
+    }
+    return result;
+}
+
+/* Reorders the values and returns their median in O(n), for an even number of values the midpoint of the two
+ * middle values (rounded towards the lower one). After the upper middle value is selected, the lower one is
+ * the maximum of the values in front of it, so both parities need a single selection. */
+template<typename T>
+[[nodiscard]] T median(const std::span<T> values) {
+    assert(!values.empty());
+    const auto middle = values.begin() + static_cast<std::ptrdiff_t>(values.size() / 2);
+    std::nth_element(values.begin(), middle, values.end());
+    if (values.size() % 2 == 1) {
+        return *middle;
+    }
+    return std::midpoint(*std::max_element(values.begin(), middle), *middle);
+}
+
+template<typename T>
+[[nodiscard]] T median(std::vector<T>& values) {
+    return median(std::span<T>{ values });
+}
+
+template<typename T>
+struct Point {
+    T x, y;
+
+    [[nodiscard]] bool operator==(const Point&) const = default;
+
+    [[nodiscard]] constexpr Point operator+(const Point& other) const {
+        auto result = *this;
+        result += other;
+        return result;
+    }
+
+    constexpr Point operator+=(const Point& other) {
+        Point result{ x, y };
+        x += other.x;
+        y += other.y;
+        return result;
+    }
+};
+
+template<typename T>
+struct Point3D {
+    T x, y, z;
+
+    [[nodiscard]] bool operator==(const Point3D&) const = default;
+
+    [[nodiscard]] constexpr Point3D operator+(const Point3D& other) const {
+        auto result = *this;
+        result += other;
+        return result;
+    }
+
+    constexpr Point3D operator+=(const Point3D& other) {
+        Point3D result{ x, y, z };
+        x += other.x;
+        y += other.y;
+        z += other.z;
+        return result;
+    }
+};
+
+using PointUZ = Point<uz>;
+using PointU32 = Point<u32>;
+using PointI32 = Point<i32>;
+
+/* Hashing: a key is split into 64 bit words by hashWords() (overloads for other keys are found through ADL),
+ * which are then mixed by one of the hashers below. std::hash of integers is the identity on libstdc++, so
+ * the old boost-style combination of the component hashes left most of the bits untouched and collided
+ * heavily in power of two sized tables. The hasher can be chosen per container, e.g.
+ * std::unordered_set<PointI32, WyHasher<PointI32>> or FlatPointSet<PointI32, WyHasher<PointI32>>. */
+
+template<std::integral T>
+[[nodiscard]] constexpr std::array<u64, 1> hashWords(const T value) {
+    return { static_cast<u64>(value) };
+}
+
+// both coordinates share a word if they fit
+template<typename T>
+[[nodiscard]] constexpr auto hashWords(const Point<T>& point) {
+    if constexpr (sizeof(T) <= 4) {
+        using Unsigned = std::make_unsigned_t<T>;
+        return std::array<u64, 1>{ (static_cast<u64>(static_cast<Unsigned>(point.x)) << 32) |
+                                   static_cast<u64>(static_cast<Unsigned>(point.y)) };
+    } else {
+        return std::array<u64, 2>{ static_cast<u64>(point.x), static_cast<u64>(point.y) };
+    }
+}
+
+template<typename T>
+[[nodiscard]] constexpr std::array<u64, 3> hashWords(const Point3D<T>& point) {
+    return { static_cast<u64>(point.x), static_cast<u64>(point.y), static_cast<u64>(point.z) };
+}
+
+template<std::integral First, std::integral Second>
+[[nodiscard]] constexpr auto hashWords(const std::pair<First, Second>& pair) {
+    if constexpr (sizeof(First) <= 4 && sizeof(Second) <= 4) {
+        return std::array<u64, 1>{ (static_cast<u64>(static_cast<std::make_unsigned_t<First>>(pair.first)) << 32) |
+                                   static_cast<u64>(static_cast<std::make_unsigned_t<Second>>(pair.second)) };
+    } else {
+        return std::array<u64, 2>{ static_cast<u64>(pair.first), static_cast<u64>(pair.second) };
+    }
+}
+
+// murmur3's 64 bit finalizer, every input bit affects every output bit
+[[nodiscard]] constexpr u64 murmur3Mix(u64 value) {
+    value ^= value >> 33;
+    value *= 0xff51afd7ed558ccdULL;
+    value ^= value >> 33;
+    value *= 0xc4ceb9fe1a85ec53ULL;
+    value ^= value >> 33;
+    return value;
+}
+
+// wyhash's mixing step: the 128 bit product of both values folded to 64 bits
+[[nodiscard]] inline u64 wyMix(const u64 lhs, const u64 rhs) {
+#if defined(__SIZEOF_INT128__)
+    const auto product = static_cast<unsigned __int128>(lhs) * rhs;
+    return static_cast<u64>(product) ^ static_cast<u64>(product >> 64);
+#elif defined(_M_X64)
+    auto high = u64{};
+    const auto low = _umul128(lhs, rhs, &high);
+    return low ^ high;
+#else
+    const auto lowLow = (lhs & 0xFFFF'FFFF) * (rhs & 0xFFFF'FFFF);
+    const auto highLow = (lhs >> 32) * (rhs & 0xFFFF'FFFF);
+    const auto lowHigh = (lhs & 0xFFFF'FFFF) * (rhs >> 32);
+    const auto highHigh = (lhs >> 32) * (rhs >> 32);
+    const auto middle = (lowLow >> 32) + (highLow & 0xFFFF'FFFF) + (lowHigh & 0xFFFF'FFFF);
+    const auto low = (middle << 32) | (lowLow & 0xFFFF'FFFF);
+    const auto high = highHigh + (highLow >> 32) + (lowHigh >> 32) + (middle >> 32);
+    return low ^ high;
+#endif
+}
+
+template<typename Key>
+struct Murmur3Hasher {
+    [[nodiscard]] uz operator()(const Key& key) const {
+        auto result = u64{ 0 };
+        for (const auto word : hashWords(key)) {
+            result = murmur3Mix(result ^ word);
+        }
+        return static_cast<uz>(result);
+    }
+};
+
+// one multiplication per word, usually the fastest of the hashers
+template<typename Key>
+struct WyHasher {
+    [[nodiscard]] uz operator()(const Key& key) const {
+        constexpr auto secret0 = u64{ 0xa0761d6478bd642fULL };
+        constexpr auto secret1 = u64{ 0xe7037ed1a0b428dbULL };
+        auto result = u64{ 0 };
+        for (const auto word : hashWords(key)) {
+            result = wyMix(word ^ secret0, result ^ secret1);
+        }
+        return static_cast<uz>(result);
+    }
+};
+
+namespace std {
+    template<typename T>
+    struct hash<Point<T>> : Murmur3Hasher<Point<T>> { };
+
+    template<typename T>
+    struct hash<Point3D<T>> : Murmur3Hasher<Point3D<T>> { };
+}// namespace std
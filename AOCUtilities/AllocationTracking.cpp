@@ -0,0 +1,174 @@
+#include "AllocationTracking.hpp"
+#include <algorithm>
+#include <atomic>
+#include <cstdlib>
+#include <new>
+#if defined(_MSC_VER)
+#include <malloc.h>
+#elif defined(__APPLE__)
+#include <malloc/malloc.h>
+#else
+#include <malloc.h>
+#endif
+
+namespace {
+    std::atomic<u64> numAllocations{ 0 };
+    std::atomic<u64> numBytes{ 0 };
+    std::atomic<u64> bytesInUse{ 0 };
+    std::atomic<u64> peakBytesInUse{ 0 };
+
+    [[nodiscard]] std::size_t effectiveAlignment(const std::size_t alignment) {
+        return std::max(alignment, alignof(std::max_align_t));
+    }
+
+    // what the allocator handed out for the block, which can be more than requested
+    [[nodiscard]] std::size_t usableSize(void* const pointer, [[maybe_unused]] const std::size_t alignment) {
+#if defined(_MSC_VER)
+        return _aligned_msize(pointer, effectiveAlignment(alignment), 0);
+#elif defined(__APPLE__)
+        return malloc_size(pointer);
+#else
+        return malloc_usable_size(pointer);
+#endif
+    }
+
+    void addBytesInUse(const u64 bytes) {
+        const auto inUse = bytesInUse.fetch_add(bytes, std::memory_order_relaxed) + bytes;
+        auto peak = peakBytesInUse.load(std::memory_order_relaxed);
+        while (inUse > peak && !peakBytesInUse.compare_exchange_weak(peak, inUse, std::memory_order_relaxed)) { }
+    }
+
+    [[nodiscard]] void* countedAllocate(const std::size_t size, const std::size_t alignment) {
+#if defined(_MSC_VER)
+        // MSVC has no aligned_alloc, and what _aligned_malloc returns has to be freed by _aligned_free
+        auto* const pointer = _aligned_malloc(size == 0 ? 1 : size, effectiveAlignment(alignment));
+#else
+        // aligned_alloc wants a multiple of the alignment
+        auto* const pointer = (alignment <= alignof(std::max_align_t))
+                                      ? std::malloc(size == 0 ? 1 : size)
+                                      : std::aligned_alloc(alignment, (size + alignment - 1) / alignment * alignment);
+#endif
+        if (pointer != nullptr) {
+            numAllocations.fetch_add(1, std::memory_order_relaxed);
+            numBytes.fetch_add(size, std::memory_order_relaxed);
+            addBytesInUse(usableSize(pointer, alignment));
+        }
+        return pointer;
+    }
+
+    void release(void* const pointer, const std::size_t alignment = alignof(std::max_align_t)) {
+        if (pointer == nullptr) {
+            return;
+        }
+        bytesInUse.fetch_sub(usableSize(pointer, alignment), std::memory_order_relaxed);
+#if defined(_MSC_VER)
+        _aligned_free(pointer);
+#else
+        std::free(pointer);
+#endif
+    }
+
+    [[nodiscard]] void* countedAllocateOrThrow(const std::size_t size, const std::size_t alignment) {
+        auto* const pointer = countedAllocate(size, alignment);
+        if (pointer == nullptr) {
+            throw std::bad_alloc{};
+        }
+        return pointer;
+    }
+}// namespace
+
+AllocationCount allocationCount() {
+    return AllocationCount{ numAllocations.load(std::memory_order_relaxed), numBytes.load(std::memory_order_relaxed) };
+}
+
+u64 heapBytesInUse() {
+    return bytesInUse.load(std::memory_order_relaxed);
+}
+
+u64 peakHeapBytes() {
+    return peakBytesInUse.load(std::memory_order_relaxed);
+}
+
+void resetPeakHeapBytes() {
+    peakBytesInUse.store(bytesInUse.load(std::memory_order_relaxed), std::memory_order_relaxed);
+}
+
+void* operator new(const std::size_t size) {
+    return countedAllocateOrThrow(size, alignof(std::max_align_t));
+}
+
+void* operator new[](const std::size_t size) {
+    return countedAllocateOrThrow(size, alignof(std::max_align_t));
+}
+
+void* operator new(const std::size_t size, const std::align_val_t alignment) {
+    return countedAllocateOrThrow(size, static_cast<std::size_t>(alignment));
+}
+
+void* operator new[](const std::size_t size, const std::align_val_t alignment) {
+    return countedAllocateOrThrow(size, static_cast<std::size_t>(alignment));
+}
+
+void* operator new(const std::size_t size, const std::nothrow_t&) noexcept {
+    return countedAllocate(size, alignof(std::max_align_t));
+}
+
+void* operator new[](const std::size_t size, const std::nothrow_t&) noexcept {
+    return countedAllocate(size, alignof(std::max_align_t));
+}
+
+void* operator new(const std::size_t size, const std::align_val_t alignment, const std::nothrow_t&) noexcept {
+    return countedAllocate(size, static_cast<std::size_t>(alignment));
+}
+
+void* operator new[](const std::size_t size, const std::align_val_t alignment, const std::nothrow_t&) noexcept {
+    return countedAllocate(size, static_cast<std::size_t>(alignment));
+}
+
+void operator delete(void* const pointer) noexcept {
+    release(pointer);
+}
+
+void operator delete[](void* const pointer) noexcept {
+    release(pointer);
+}
+
+void operator delete(void* const pointer, std::size_t) noexcept {
+    release(pointer);
+}
+
+void operator delete[](void* const pointer, std::size_t) noexcept {
+    release(pointer);
+}
+
+void operator delete(void* const pointer, const std::align_val_t alignment) noexcept {
+    release(pointer, static_cast<std::size_t>(alignment));
+}
+
+void operator delete[](void* const pointer, const std::align_val_t alignment) noexcept {
+    release(pointer, static_cast<std::size_t>(alignment));
+}
+
+void operator delete(void* const pointer, std::size_t, const std::align_val_t alignment) noexcept {
+    release(pointer, static_cast<std::size_t>(alignment));
+}
+
+void operator delete[](void* const pointer, std::size_t, const std::align_val_t alignment) noexcept {
+    release(pointer, static_cast<std::size_t>(alignment));
+}
+
+void operator delete(void* const pointer, const std::nothrow_t&) noexcept {
+    release(pointer);
+}
+
+void operator delete[](void* const pointer, const std::nothrow_t&) noexcept {
+    release(pointer);
+}
+
+void operator delete(void* const pointer, const std::align_val_t alignment, const std::nothrow_t&) noexcept {
+    release(pointer, static_cast<std::size_t>(alignment));
+}
+
+void operator delete[](void* const pointer, const std::align_val_t alignment, const std::nothrow_t&) noexcept {
+    release(pointer, static_cast<std::size_t>(alignment));
+}
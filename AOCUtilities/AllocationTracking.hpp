@@ -0,0 +1,32 @@
+#pragma once
+
+#include "AOCUtilities.hpp"
+
+/* Opt-in heap instrumentation: AllocationTracking.cpp replaces the global operator new and delete to count the
+ * allocations and to follow the heap in use, measured by the usable size of every block (malloc_usable_size and
+ * its equivalents), including its peak. It is built as the object library aoc_allocation_tracking, which only
+ * programs that want the numbers link, like the benchmark harness; the solvers pay nothing for it.
+ *
+ * Allocations of the std::pmr resources only show up when they have to go to the heap, which is exactly what
+ * an arena is supposed to avoid. */
+
+struct AllocationCount {
+    u64 allocations{ 0 };
+    u64 bytes{ 0 };// requested, the heap in use below counts what the allocator actually handed out
+
+    [[nodiscard]] AllocationCount operator-(const AllocationCount& other) const {
+        return AllocationCount{ allocations - other.allocations, bytes - other.bytes };
+    }
+};
+
+// allocations of all threads since the start of the program
+[[nodiscard]] AllocationCount allocationCount();
+
+// bytes of all heap blocks allocated through operator new and not freed yet
+[[nodiscard]] u64 heapBytesInUse();
+
+// the highest heapBytesInUse() since the start of the program or the last resetPeakHeapBytes()
+[[nodiscard]] u64 peakHeapBytes();
+
+// starts a new peak at the current heap in use, e.g. at the beginning of a phase
+void resetPeakHeapBytes();
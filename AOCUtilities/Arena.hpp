@@ -0,0 +1,43 @@
+#pragma once
+
+#include "AOCUtilities.hpp"
+#include <array>
+#include <cstddef>
+#include <memory_resource>
+
+/* Memory for temporaries that all die at the same time, like the containers built for one line or one step
+ * of a puzzle. Allocations are served from a buffer inside the arena by bumping a pointer, deallocating does
+ * nothing, and reset() makes the whole buffer available again. Only when a line needs more than the inline
+ * buffer the arena falls back to the upstream resource (which reset() releases again).
+ *
+ *     auto arena = Arena{};
+ *     for (const auto line : lines) {
+ *         arena.reset();
+ *         auto counts = std::pmr::unordered_map<i64, uz>{ arena.resource() };
+ *         ...
+ *     }
+ *
+ * The containers using the arena have to be destroyed before reset() is called. For temporaries that are
+ * freed and allocated again individually, std::pmr::unsynchronized_pool_resource fits better. */
+template<uz InlineBytes = 4096>
+class Arena {
+public:
+    explicit Arena(std::pmr::memory_resource* const upstream = std::pmr::new_delete_resource())
+        : mResource{ mBuffer.data(), mBuffer.size(), upstream } { }
+
+    Arena(const Arena&) = delete;
+    Arena& operator=(const Arena&) = delete;
+
+    [[nodiscard]] std::pmr::memory_resource* resource() {
+        return &mResource;
+    }
+
+    // releases everything allocated since the last reset, starting over at the inline buffer
+    void reset() {
+        mResource.release();
+    }
+
+private:
+    alignas(std::max_align_t) std::array<std::byte, InlineBytes> mBuffer;
+    std::pmr::monotonic_buffer_resource mResource;
+};
@@ -0,0 +1,188 @@
+#include "BitGrid.hpp"
+#include "CpuDispatch.hpp"
+#include <algorithm>
+
+namespace {
+    // sets or clears the bits [begin, end) of a row
+    void fillRow(const std::span<BitWord> row, const uz begin, const uz end, const bool value) {
+        for (auto bit = begin; bit < end;) {
+            const auto index = bit / bitsPerWord;
+            const auto wordEnd = std::min(end, (index + 1) * bitsPerWord);
+            const auto mask = bitMask(bit % bitsPerWord, wordEnd - index * bitsPerWord);
+            row[index] = value ? (row[index] | mask) : (row[index] & ~mask);
+            bit = wordEnd;
+        }
+    }
+
+    // the row operations compiled for every SIMD tier, whole grids are combined through them as a single row
+    AOC_MULTIVERSIONED_KERNEL(void, andWords, (BitWord* const row, const BitWord* const other, const uz size), {
+        for (auto i = uz{ 0 }; i < size; ++i) {
+            row[i] &= other[i];
+        }
+    })
+
+    AOC_MULTIVERSIONED_KERNEL(void, orWords, (BitWord* const row, const BitWord* const other, const uz size), {
+        for (auto i = uz{ 0 }; i < size; ++i) {
+            row[i] |= other[i];
+        }
+    })
+
+    AOC_MULTIVERSIONED_KERNEL(void, xorWords, (BitWord* const row, const BitWord* const other, const uz size), {
+        for (auto i = uz{ 0 }; i < size; ++i) {
+            row[i] ^= other[i];
+        }
+    })
+
+    // a popcnt instruction from SSE4.2 on, a table lookup or vpopcntq in the vectorized loops
+    AOC_MULTIVERSIONED_KERNEL(uz, countWords, (const BitWord* const words, const uz size), {
+        auto count = uz{ 0 };
+        for (auto i = uz{ 0 }; i < size; ++i) {
+            count += static_cast<uz>(std::popcount(words[i]));
+        }
+        return count;
+    })
+}// namespace
+
+void andRow(const std::span<BitWord> row, const std::span<const BitWord> other) {
+    assert(row.size() == other.size());
+    static const auto kernel = selectKernel(AOC_KERNEL_VARIANTS(andWords));
+    kernel(row.data(), other.data(), row.size());
+}
+
+void orRow(const std::span<BitWord> row, const std::span<const BitWord> other) {
+    assert(row.size() == other.size());
+    static const auto kernel = selectKernel(AOC_KERNEL_VARIANTS(orWords));
+    kernel(row.data(), other.data(), row.size());
+}
+
+void xorRow(const std::span<BitWord> row, const std::span<const BitWord> other) {
+    assert(row.size() == other.size());
+    static const auto kernel = selectKernel(AOC_KERNEL_VARIANTS(xorWords));
+    kernel(row.data(), other.data(), row.size());
+}
+
+void shiftRowUp(const std::span<BitWord> row, const uz shift) {
+    const auto wordShift = std::min(shift / bitsPerWord, row.size());
+    const auto bitShift = shift % bitsPerWord;
+    // from the top, so every word is read before it is overwritten
+    for (auto i = row.size(); i-- > wordShift;) {
+        const auto source = i - wordShift;
+        auto word = row[source] << bitShift;
+        if (bitShift != 0 && source > 0) {
+            word |= row[source - 1] >> (bitsPerWord - bitShift);
+        }
+        row[i] = word;
+    }
+    std::fill_n(row.begin(), wordShift, BitWord{ 0 });
+}
+
+void shiftRowDown(const std::span<BitWord> row, const uz shift) {
+    const auto wordShift = std::min(shift / bitsPerWord, row.size());
+    const auto bitShift = shift % bitsPerWord;
+    const auto numKept = row.size() - wordShift;
+    for (auto i = uz{ 0 }; i < numKept; ++i) {
+        const auto source = i + wordShift;
+        auto word = row[source] >> bitShift;
+        if (bitShift != 0 && source + 1 < row.size()) {
+            word |= row[source + 1] << (bitsPerWord - bitShift);
+        }
+        row[i] = word;
+    }
+    std::fill(row.begin() + static_cast<std::ptrdiff_t>(numKept), row.end(), BitWord{ 0 });
+}
+
+void reverseRow(const std::span<BitWord> row, const uz numBits) {
+    const auto numWords = numWordsFor(numBits);
+    assert(numWords <= row.size());
+    std::fill(row.begin() + static_cast<std::ptrdiff_t>(numWords), row.end(), BitWord{ 0 });
+    const auto words = row.first(numWords);
+    // reversing the words and the bits in them reverses all numWords * 64 bits, which moves the bits above
+    // numBits to the bottom, from where they are shifted out
+    std::reverse(words.begin(), words.end());
+    for (auto& word : words) {
+        word = reverseBits(word);
+    }
+    shiftRowDown(words, numWords * bitsPerWord - numBits);
+}
+
+uz countRow(const std::span<const BitWord> row, const uz begin, const uz end) {
+    if (begin >= end) {
+        return 0;
+    }
+    const auto first = begin / bitsPerWord;
+    const auto last = (end - 1) / bitsPerWord;
+    assert(last < row.size());
+    const auto lastEnd = (end - 1) % bitsPerWord + 1;
+    if (first == last) {
+        return static_cast<uz>(std::popcount(row[first] & bitMask(begin % bitsPerWord, lastEnd)));
+    }
+    static const auto kernel = selectKernel(AOC_KERNEL_VARIANTS(countWords));
+    auto count = static_cast<uz>(std::popcount(row[first] & bitMask(begin % bitsPerWord, bitsPerWord)));
+    count += kernel(row.data() + first + 1, last - first - 1);
+    return count + static_cast<uz>(std::popcount(row[last] & bitMask(0, lastEnd)));
+}
+
+BitGrid::BitGrid(const uz width, const uz height, const bool value, const uz padding)
+    : mWidth{ width },
+      mHeight{ height },
+      mPadding{ padding },
+      mWordsPerRow{ std::max(numWordsFor(width + 2 * padding), uz{ 1 }) },
+      mWords((height + 2 * padding) * mWordsPerRow, value ? ~BitWord{ 0 } : BitWord{ 0 }) {
+    if (value) {
+        for (auto y = uz{ 0 }; y < mHeight + 2 * mPadding; ++y) {
+            clearTail(std::span<BitWord>{ mWords }.subspan(y * mWordsPerRow, mWordsPerRow));
+        }
+    }
+}
+
+uz BitGrid::count() const {
+    auto count = uz{ 0 };
+    for (auto y = uz{ 0 }; y < mHeight; ++y) {
+        count += countRow(row(y), mPadding, mPadding + mWidth);
+    }
+    return count;
+}
+
+void BitGrid::fill(const bool value) {
+    for (auto y = uz{ 0 }; y < mHeight; ++y) {
+        fillRow(row(y), mPadding, mPadding + mWidth, value);
+    }
+}
+
+void BitGrid::fillPadding(const bool value) {
+    const auto rowBits = mWidth + 2 * mPadding;
+    const auto numRows = mHeight + 2 * mPadding;
+    for (auto y = uz{ 0 }; y < numRows; ++y) {
+        const auto rowWords = std::span<BitWord>{ mWords }.subspan(y * mWordsPerRow, mWordsPerRow);
+        if (y < mPadding || y >= mPadding + mHeight) {
+            fillRow(rowWords, 0, rowBits, value);
+        } else {
+            fillRow(rowWords, 0, mPadding, value);
+            fillRow(rowWords, mPadding + mWidth, rowBits, value);
+        }
+    }
+}
+
+void BitGrid::checkSameShape(const BitGrid& other) const {
+    if (mWidth != other.mWidth || mHeight != other.mHeight || mPadding != other.mPadding) {
+        throw std::runtime_error{ "Bit grids of different sizes. " };
+    }
+}
+
+BitGrid& BitGrid::operator&=(const BitGrid& other) {
+    checkSameShape(other);
+    andRow(mWords, other.mWords);
+    return *this;
+}
+
+BitGrid& BitGrid::operator|=(const BitGrid& other) {
+    checkSameShape(other);
+    orRow(mWords, other.mWords);
+    return *this;
+}
+
+BitGrid& BitGrid::operator^=(const BitGrid& other) {
+    checkSameShape(other);
+    xorRow(mWords, other.mWords);
+    return *this;
+}
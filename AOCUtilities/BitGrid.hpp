@@ -0,0 +1,218 @@
+#pragma once
+
+#include "AOCUtilities.hpp"
+#include <algorithm>
+#include <bit>
+#include <cassert>
+#include <concepts>
+#include <span>
+#include <stdexcept>
+#include <vector>
+
+/* Operations on rows of bits packed into 64 bit words, bit x of a row is bit x % 64 of its word x / 64. Up
+ * means towards higher bit indices (x + shift), down towards lower ones. */
+using BitWord = u64;
+constexpr auto bitsPerWord = uz{ 64 };
+
+[[nodiscard]] constexpr uz numWordsFor(const uz numBits) {
+    return (numBits + bitsPerWord - 1) / bitsPerWord;
+}
+
+[[nodiscard]] constexpr BitWord reverseBits(BitWord word) {
+    word = ((word >> 1) & 0x5555555555555555ULL) | ((word & 0x5555555555555555ULL) << 1);
+    word = ((word >> 2) & 0x3333333333333333ULL) | ((word & 0x3333333333333333ULL) << 2);
+    word = ((word >> 4) & 0x0f0f0f0f0f0f0f0fULL) | ((word & 0x0f0f0f0f0f0f0f0fULL) << 4);
+    return std::byteswap(word);
+}
+
+// the bits [begin, end) of a word set, the others cleared
+[[nodiscard]] constexpr BitWord bitMask(const uz begin, const uz end) {
+    assert(begin <= end && end <= bitsPerWord);
+    const auto upTo = [](const uz bit) { return bit == bitsPerWord ? ~BitWord{ 0 } : (BitWord{ 1 } << bit) - 1; };
+    return upTo(end) & ~upTo(begin);
+}
+
+void andRow(std::span<BitWord> row, std::span<const BitWord> other);
+void orRow(std::span<BitWord> row, std::span<const BitWord> other);
+void xorRow(std::span<BitWord> row, std::span<const BitWord> other);
+
+// bit x becomes bit x + shift, the lowest bits are cleared and the highest ones are shifted out
+void shiftRowUp(std::span<BitWord> row, uz shift);
+// bit x + shift becomes bit x, the highest bits are cleared
+void shiftRowDown(std::span<BitWord> row, uz shift);
+// reverses the order of the bits [0, numBits), the bits above are cleared
+void reverseRow(std::span<BitWord> row, uz numBits);
+// number of set bits in [begin, end)
+[[nodiscard]] uz countRow(std::span<const BitWord> row, uz begin, uz end);
+
+/* Dense two-dimensional grid of booleans, one bit per cell and every row starting at a word of its own, so
+ * whole rows can be combined, shifted and counted 64 cells at a time. Like Grid, it can be surrounded by
+ * padding cells on all four sides: cell x of a row is bit x + padding() of row(), coordinates from -padding()
+ * up to width() + padding() - 1 are valid for operator() and set(). The bits behind the padding of the last
+ * word of a row are always zero, code writing whole rows has to keep them that way (clearTail()). */
+class BitGrid {
+public:
+    BitGrid() = default;
+
+    // every cell including the padding is set to the value
+    BitGrid(uz width, uz height, bool value = false, uz padding = 0);
+
+    [[nodiscard]] uz width() const {
+        return mWidth;
+    }
+
+    [[nodiscard]] uz height() const {
+        return mHeight;
+    }
+
+    [[nodiscard]] uz padding() const {
+        return mPadding;
+    }
+
+    [[nodiscard]] uz wordsPerRow() const {
+        return mWordsPerRow;
+    }
+
+    // whether the coordinates are an inner cell, i.e. not part of the padding
+    [[nodiscard]] bool contains(const std::integral auto x, const std::integral auto y) const {
+        return std::in_range<uz>(x) && std::in_range<uz>(y) && static_cast<uz>(x) < mWidth &&
+               static_cast<uz>(y) < mHeight;
+    }
+
+    [[nodiscard]] bool operator()(const std::integral auto x, const std::integral auto y) const {
+        const auto bit = bitOf(x);
+        return (row(static_cast<uz>(y))[bit / bitsPerWord] >> (bit % bitsPerWord) & 1) != 0;
+    }
+
+    template<std::integral I>
+    [[nodiscard]] bool operator()(const Point<I> point) const {
+        return (*this)(point.x, point.y);
+    }
+
+    [[nodiscard]] bool at(const std::integral auto x, const std::integral auto y) const {
+        if (!contains(x, y)) {
+            throw std::runtime_error{ "Coordinates outside of the grid. " };
+        }
+        return (*this)(x, y);
+    }
+
+    void set(const std::integral auto x, const std::integral auto y, const bool value = true) {
+        const auto bit = bitOf(x);
+        auto& word = row(static_cast<uz>(y))[bit / bitsPerWord];
+        const auto mask = BitWord{ 1 } << (bit % bitsPerWord);
+        word = value ? (word | mask) : (word & ~mask);
+    }
+
+    template<std::integral I>
+    void set(const Point<I> point, const bool value = true) {
+        set(point.x, point.y, value);
+    }
+
+    /* Up to 57 consecutive cells starting at x with the cell x in the lowest bit, the neighborhood of a cell in
+     * a few shifts. Cells behind the end of the row (and its padding) read as zero. */
+    [[nodiscard]] BitWord bits(const std::integral auto x, const std::integral auto y, const uz count) const {
+        assert(count <= bitsPerWord - 7);
+        const auto bit = bitOf(x);
+        const auto words = row(static_cast<uz>(y));
+        const auto index = bit / bitsPerWord;
+        const auto shift = bit % bitsPerWord;
+        auto result = words[index] >> shift;
+        if (shift + count > bitsPerWord && index + 1 < words.size()) {
+            result |= words[index + 1] << (bitsPerWord - shift);
+        }
+        return result & bitMask(0, count);
+    }
+
+    // sets the count cells starting at x to the lowest bits of the value, the counterpart of bits()
+    void setBits(const std::integral auto x, const std::integral auto y, const uz count, const BitWord value) {
+        assert(count <= bitsPerWord - 7);
+        const auto bit = bitOf(x);
+        assert(bit + count <= mWidth + 2 * mPadding);
+        const auto words = row(static_cast<uz>(y));
+        const auto index = bit / bitsPerWord;
+        const auto shift = bit % bitsPerWord;
+        const auto mask = bitMask(0, count);
+        words[index] = (words[index] & ~(mask << shift)) | ((value & mask) << shift);
+        if (shift + count > bitsPerWord) {
+            const auto highShift = bitsPerWord - shift;
+            words[index + 1] = (words[index + 1] & ~(mask >> highShift)) | ((value & mask) >> highShift);
+        }
+    }
+
+    // all words of a row including its padding, y may be in the padding as well
+    [[nodiscard]] std::span<BitWord> row(const uz y) {
+        const auto index = (y + mPadding) * mWordsPerRow;
+        assert(index < mWords.size());
+        return std::span<BitWord>{ mWords }.subspan(index, mWordsPerRow);
+    }
+
+    [[nodiscard]] std::span<const BitWord> row(const uz y) const {
+        const auto index = (y + mPadding) * mWordsPerRow;
+        assert(index < mWords.size());
+        return std::span<const BitWord>{ mWords }.subspan(index, mWordsPerRow);
+    }
+
+    // all words including the padding
+    [[nodiscard]] std::span<BitWord> words() {
+        return mWords;
+    }
+
+    [[nodiscard]] std::span<const BitWord> words() const {
+        return mWords;
+    }
+
+    // number of set inner cells
+    [[nodiscard]] uz count() const;
+
+    // calls visitor(x, y) for every set inner cell, row by row, skipping the cleared ones a word at a time
+    template<typename Visitor>
+    void forEachSet(Visitor&& visitor) const {
+        for (auto y = uz{ 0 }; y < mHeight; ++y) {
+            const auto words = row(y);
+            for (auto index = uz{ 0 }; index < words.size(); ++index) {
+                const auto begin = index * bitsPerWord;
+                // without the padding on both sides of the row
+                auto word = words[index] & bitMask(std::clamp(mPadding, begin, begin + bitsPerWord) - begin,
+                                                   std::clamp(mPadding + mWidth, begin, begin + bitsPerWord) - begin);
+                while (word != 0) {
+                    visitor(begin + static_cast<uz>(std::countr_zero(word)) - mPadding, y);
+                    word &= word - 1;
+                }
+            }
+        }
+    }
+
+    // sets the inner cells to the value
+    void fill(bool value);
+
+    // sets the padding cells to the value
+    void fillPadding(bool value);
+
+    // clears the bits behind the padding of the last word of a row
+    void clearTail(std::span<BitWord> words) const {
+        words.back() &= bitMask(0, mWidth + 2 * mPadding - (mWordsPerRow - 1) * bitsPerWord);
+    }
+
+    // cell-wise with a grid of the same size and padding
+    BitGrid& operator&=(const BitGrid& other);
+    BitGrid& operator|=(const BitGrid& other);
+    BitGrid& operator^=(const BitGrid& other);
+
+    [[nodiscard]] bool operator==(const BitGrid&) const = default;
+
+private:
+    // the bit of the cell x in its row, wrapped around coordinates work like in Grid
+    [[nodiscard]] uz bitOf(const std::integral auto x) const {
+        const auto bit = static_cast<uz>(x) + mPadding;
+        assert(bit < mWidth + 2 * mPadding);
+        return bit;
+    }
+
+    void checkSameShape(const BitGrid& other) const;
+
+    uz mWidth{ 0 };
+    uz mHeight{ 0 };
+    uz mPadding{ 0 };
+    uz mWordsPerRow{ 0 };
+    std::vector<BitWord> mWords;
+};
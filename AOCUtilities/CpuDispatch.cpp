@@ -0,0 +1,118 @@
+#include "CpuDispatch.hpp"
+#include <array>
+#include <cstdlib>
+#include <stdexcept>
+#include <string>
+
+#if AOC_SIMD_DISPATCH
+#if defined(_MSC_VER)
+#include <intrin.h>
+#else
+#include <cpuid.h>
+#endif
+#endif
+
+namespace {
+    constexpr auto simdTierNames = std::array<std::string_view, 4>{ "scalar", "sse4.2", "avx2", "avx512" };
+
+#if AOC_SIMD_DISPATCH
+    struct CpuidRegisters {
+        u32 eax;
+        u32 ebx;
+        u32 ecx;
+        u32 edx;
+    };
+
+    [[nodiscard]] CpuidRegisters cpuid(const u32 leaf, const u32 subleaf) {
+#if defined(_MSC_VER)
+        auto registers = std::array<int, 4>{};
+        __cpuidex(registers.data(), static_cast<int>(leaf), static_cast<int>(subleaf));
+        return CpuidRegisters{ static_cast<u32>(registers[0]), static_cast<u32>(registers[1]),
+                               static_cast<u32>(registers[2]), static_cast<u32>(registers[3]) };
+#else
+        auto registers = CpuidRegisters{};
+        __cpuid_count(leaf, subleaf, registers.eax, registers.ebx, registers.ecx, registers.edx);
+        return registers;
+#endif
+    }
+
+    // the register states the operating system saves on context switches
+    [[nodiscard]] u64 enabledRegisterStates() {
+#if defined(_MSC_VER)
+        return _xgetbv(0);
+#else
+        auto low = u32{};
+        auto high = u32{};
+        __asm__("xgetbv" : "=a"(low), "=d"(high) : "c"(0));
+        return (u64{ high } << 32) | low;
+#endif
+    }
+
+    [[nodiscard]] bool hasBits(const u32 value, const u32 bits) {
+        return (value & bits) == bits;
+    }
+
+    [[nodiscard]] SimdTier detectTier() {
+        const auto maxLeaf = cpuid(0, 0).eax;
+        const auto features = cpuid(1, 0);
+        // SSE4.2, POPCNT
+        if (!hasBits(features.ecx, (1u << 20) | (1u << 23))) {
+            return SimdTier::Scalar;
+        }
+        // OSXSAVE and AVX, then the XMM and YMM state enabled by the operating system
+        if (!hasBits(features.ecx, (1u << 27) | (1u << 28)) || maxLeaf < 7) {
+            return SimdTier::Sse42;
+        }
+        const auto registerStates = enabledRegisterStates();
+        const auto extended = cpuid(7, 0);
+        // AVX2, BMI1, BMI2, FMA and LZCNT (in the extended leaf 0x80000001)
+        const auto hasLzcnt = cpuid(0x80000000, 0).eax >= 0x80000001 && hasBits(cpuid(0x80000001, 0).ecx, 1u << 5);
+        if ((registerStates & 0x6) != 0x6 || !hasBits(extended.ebx, (1u << 5) | (1u << 3) | (1u << 8)) ||
+            !hasBits(features.ecx, 1u << 12) || !hasLzcnt) {
+            return SimdTier::Sse42;
+        }
+        // AVX-512 F, DQ, CD, BW and VL, then the opmask and upper ZMM states
+        if (!hasBits(extended.ebx, (1u << 16) | (1u << 17) | (1u << 28) | (1u << 30) | (1u << 31)) ||
+            (registerStates & 0xE6) != 0xE6) {
+            return SimdTier::Avx2;
+        }
+        return SimdTier::Avx512;
+    }
+#else
+    [[nodiscard]] SimdTier detectTier() {
+        return SimdTier::Scalar;
+    }
+#endif
+
+    [[nodiscard]] SimdTier tierFromEnvironment(const SimdTier detected) {
+        const auto* const value = std::getenv("AOC_SIMD_TIER");
+        if (value == nullptr || *value == '\0') {
+            return detected;
+        }
+        const auto name = std::string_view{ value };
+        for (auto tier = uz{ 0 }; tier < simdTierNames.size(); ++tier) {
+            if (simdTierNames[tier] != name) {
+                continue;
+            }
+            if (static_cast<SimdTier>(tier) > detected) {
+                throw std::runtime_error{ "AOC_SIMD_TIER " + std::string{ name } + " is not supported by this CPU. " };
+            }
+            return static_cast<SimdTier>(tier);
+        }
+        throw std::runtime_error{ "AOC_SIMD_TIER is not one of scalar, sse4.2, avx2 and avx512. " };
+    }
+}// namespace
+
+std::string_view simdTierName(const SimdTier tier) {
+    return simdTierNames[static_cast<uz>(tier)];
+}
+
+SimdTier detectedSimdTier() {
+    static const auto tier = detectTier();
+    return tier;
+}
+
+SimdTier activeSimdTier() {
+    static const auto tier = tierFromEnvironment(detectedSimdTier());
+    return tier;
+}
@@ -0,0 +1,103 @@
+#pragma once
+
+#include "AOCUtilities.hpp"
+#include <string_view>
+
+/* Runtime dispatch of vectorized kernels, so a single binary built for the baseline of the architecture (see
+ * AOC_MARCH) still uses the vector instructions of the machine it runs on. A kernel has an implementation per
+ * SIMD tier, selectKernel() picks the best one the CPU supports when it is first needed and the caller keeps
+ * the function pointer in a function-local static:
+ *
+ *     AOC_MULTIVERSIONED_KERNEL(void, orWords, (BitWord* row, const BitWord* other, uz size), {
+ *         for (auto i = uz{ 0 }; i < size; ++i) {
+ *             row[i] |= other[i];
+ *         }
+ *     })
+ *
+ *     void orRow(...) {
+ *         static const auto kernel = selectKernel(AOC_KERNEL_VARIANTS(orWords));
+ *         kernel(row.data(), other.data(), row.size());
+ *     }
+ *
+ * AOC_MULTIVERSIONED_KERNEL compiles the same body once per tier, for loops the compiler vectorizes on its own.
+ * Hand-written intrinsics go into functions marked with AOC_TARGET_SSE42, AOC_TARGET_AVX2 or AOC_TARGET_AVX512
+ * instead, listed in a KernelVariants with nullptr for the tiers without an implementation of their own.
+ *
+ * The tier is detected with cpuid (including whether the operating system saves the wider registers) and can be
+ * lowered for testing with the environment variable AOC_SIMD_TIER=scalar|sse4.2|avx2|avx512. */
+
+enum class SimdTier : u8 {
+    Scalar,// the baseline the project is compiled for, SSE2 on x86-64
+    Sse42, // SSE4.2 and POPCNT
+    Avx2,  // AVX2, FMA, BMI1, BMI2 and LZCNT
+    Avx512,// AVX-512 F, BW, VL, DQ and CD
+};
+
+[[nodiscard]] std::string_view simdTierName(SimdTier tier);
+
+// the best tier of the CPU
+[[nodiscard]] SimdTier detectedSimdTier();
+
+// the tier the kernels are selected for, detectedSimdTier() unless AOC_SIMD_TIER lowers it
+[[nodiscard]] SimdTier activeSimdTier();
+
+#if (defined(__x86_64__) || defined(_M_X64)) && !defined(AOC_DISABLE_SIMD_DISPATCH)
+#define AOC_SIMD_DISPATCH 1
+#else
+#define AOC_SIMD_DISPATCH 0
+#endif
+
+// MSVC compiles intrinsics of every instruction set without being asked to, but only vectorizes for its /arch
+#if AOC_SIMD_DISPATCH && (defined(__GNUC__) || defined(__clang__))
+#define AOC_TARGET_SSE42 __attribute__((target("sse4.2,popcnt")))
+#define AOC_TARGET_AVX2 __attribute__((target("avx2,fma,bmi,bmi2,lzcnt,popcnt")))
+#define AOC_TARGET_AVX512                                                                                              \
+    __attribute__((target("avx512f,avx512bw,avx512vl,avx512dq,avx512cd,avx2,fma,bmi,bmi2,lzcnt,popcnt")))
+#else
+#define AOC_TARGET_SSE42
+#define AOC_TARGET_AVX2
+#define AOC_TARGET_AVX512
+#endif
+
+template<typename Function>
+struct KernelVariants {
+    Function* scalar;
+    Function* sse42{ nullptr };
+    Function* avx2{ nullptr };
+    Function* avx512{ nullptr };
+};
+
+// the variant of the highest tier up to activeSimdTier() that has an implementation
+template<typename Function>
+[[nodiscard]] Function* selectKernel(const KernelVariants<Function>& variants) {
+    const auto tier = activeSimdTier();
+    if (tier >= SimdTier::Avx512 && variants.avx512 != nullptr) {
+        return variants.avx512;
+    }
+    if (tier >= SimdTier::Avx2 && variants.avx2 != nullptr) {
+        return variants.avx2;
+    }
+    if (tier >= SimdTier::Sse42 && variants.sse42 != nullptr) {
+        return variants.sse42;
+    }
+    return variants.scalar;
+}
+
+#if AOC_SIMD_DISPATCH
+#define AOC_MULTIVERSIONED_KERNEL(returnType, name, parameters, ...)                                                   \
+    [[maybe_unused]] static returnType name##Scalar parameters __VA_ARGS__                                             \
+    [[maybe_unused]] AOC_TARGET_SSE42 static returnType name##Sse42 parameters __VA_ARGS__                             \
+    [[maybe_unused]] AOC_TARGET_AVX2 static returnType name##Avx2 parameters __VA_ARGS__                               \
+    [[maybe_unused]] AOC_TARGET_AVX512 static returnType name##Avx512 parameters __VA_ARGS__
+#define AOC_KERNEL_VARIANTS(name)                                                                                      \
+    KernelVariants<decltype(name##Scalar)> {                                                                           \
+        name##Scalar, name##Sse42, name##Avx2, name##Avx512                                                            \
+    }
+#else
+#define AOC_MULTIVERSIONED_KERNEL(returnType, name, parameters, ...)                                                   \
+    [[maybe_unused]] static returnType name##Scalar parameters __VA_ARGS__
+#define AOC_KERNEL_VARIANTS(name)                                                                                      \
+    KernelVariants<decltype(name##Scalar)> {                                                                           \
+        name##Scalar                                                                                                   \
+    }
+#endif
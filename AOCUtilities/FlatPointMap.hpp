@@ -0,0 +1,432 @@
+#pragma once
+
+#include "AOCUtilities.hpp"
+#include <array>
+#include <functional>
+#include <iterator>
+#include <optional>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+/* Open addressing hash containers for small, trivially copyable keys like the points of the grid puzzles.
+ * Unlike the node-based std containers, inserting does not allocate (except for growing) and a lookup only
+ * touches a byte array of metadata and one contiguous array of slots.
+ *
+ * The layout follows the Swiss table design: every slot has a control byte that is either empty, deleted
+ * or holds the lower 7 bits of the hash of its key. The control bytes are probed in groups of 16, which are
+ * compared against the hash with a single SSE2 instruction, so a lookup usually compares only one key.
+ * Both the fingerprint and the group are taken directly from the hash, so the hasher has to mix all bits
+ * (like the hashers of AOCUtilities.hpp, an identity hash would cluster the keys). */
+
+namespace detail {
+    using ControlByte = i8;
+
+    constexpr auto emptyControl = ControlByte{ -128 };// 0b1000'0000
+    constexpr auto deletedControl = ControlByte{ -2 };// 0b1111'1110
+    constexpr auto groupSize = uz{ 16 };
+
+    // the control bytes of a group as a bit mask, bit i is set if the i-th control byte matches
+    class ControlGroup {
+    public:
+        explicit ControlGroup(const ControlByte* const control) {
+#if defined(__SSE2__) || defined(_M_X64)
+            mControl = _mm_loadu_si128(reinterpret_cast<const __m128i*>(control));
+#else
+            std::memcpy(mControl.data(), control, groupSize);
+#endif
+        }
+
+        [[nodiscard]] u32 match(const ControlByte value) const {
+#if defined(__SSE2__) || defined(_M_X64)
+            return static_cast<u32>(_mm_movemask_epi8(_mm_cmpeq_epi8(mControl, _mm_set1_epi8(value))));
+#else
+            auto result = u32{ 0 };
+            for (auto i = uz{ 0 }; i < groupSize; ++i) {
+                result |= static_cast<u32>(mControl[i] == value) << i;
+            }
+            return result;
+#endif
+        }
+
+        [[nodiscard]] u32 matchEmpty() const {
+            return match(emptyControl);
+        }
+
+        // empty and deleted are the only control bytes with the sign bit set
+        [[nodiscard]] u32 matchEmptyOrDeleted() const {
+#if defined(__SSE2__) || defined(_M_X64)
+            return static_cast<u32>(_mm_movemask_epi8(mControl));
+#else
+            auto result = u32{ 0 };
+            for (auto i = uz{ 0 }; i < groupSize; ++i) {
+                result |= static_cast<u32>(mControl[i] < 0) << i;
+            }
+            return result;
+#endif
+        }
+
+    private:
+#if defined(__SSE2__) || defined(_M_X64)
+        __m128i mControl;
+#else
+        std::array<ControlByte, groupSize> mControl;
+#endif
+    };
+
+    // shared implementation of FlatPointSet (Value = void) and FlatPointMap
+    template<typename Key, typename Value, typename Hash>
+    class FlatPointTable {
+        static_assert(std::is_trivially_copyable_v<Key>, "Keys are copied around while probing and rehashing. ");
+
+        static constexpr auto isSet = std::is_void_v<Value>;
+        static constexpr auto notFound = ~uz{ 0 };
+
+    public:
+        using key_type = Key;
+        using value_type = std::conditional_t<isSet, Key, std::pair<Key, Value>>;
+        using size_type = uz;
+
+        template<bool IsConst>
+        class Iterator {
+        public:
+            using Table = std::conditional_t<IsConst, const FlatPointTable, FlatPointTable>;
+            using iterator_category = std::forward_iterator_tag;
+            using difference_type = std::ptrdiff_t;
+            using value_type = FlatPointTable::value_type;
+            // the keys of the set cannot be modified, they determine the position
+            using reference = std::conditional_t<IsConst || isSet, const value_type&, value_type&>;
+            using pointer = std::conditional_t<IsConst || isSet, const value_type*, value_type*>;
+
+            Iterator() = default;
+
+            Iterator(Table* const table, const uz index) : mTable{ table }, mIndex{ index } {
+                skipUnused();
+            }
+
+            // iterator to const_iterator
+            template<bool OtherConst>
+                requires(IsConst && !OtherConst)
+            Iterator(const Iterator<OtherConst>& other) : mTable{ other.mTable }, mIndex{ other.mIndex } { }
+
+            [[nodiscard]] reference operator*() const {
+                return mTable->mSlots[mIndex];
+            }
+
+            [[nodiscard]] pointer operator->() const {
+                return &mTable->mSlots[mIndex];
+            }
+
+            Iterator& operator++() {
+                ++mIndex;
+                skipUnused();
+                return *this;
+            }
+
+            Iterator operator++(int) {
+                auto result = *this;
+                ++(*this);
+                return result;
+            }
+
+            [[nodiscard]] bool operator==(const Iterator& other) const {
+                return mIndex == other.mIndex;
+            }
+
+        private:
+            void skipUnused() {
+                while (mIndex < mTable->capacity() && mTable->mControl[mIndex] < 0) {
+                    ++mIndex;
+                }
+            }
+
+        private:
+            template<bool>
+            friend class Iterator;
+            friend class FlatPointTable;
+
+            Table* mTable{ nullptr };
+            uz mIndex{ 0 };
+        };
+
+        using iterator = Iterator<false>;
+        using const_iterator = Iterator<true>;
+
+        FlatPointTable() = default;
+
+        explicit FlatPointTable(const uz expectedSize) {
+            reserve(expectedSize);
+        }
+
+        [[nodiscard]] iterator begin() {
+            return iterator{ this, 0 };
+        }
+
+        [[nodiscard]] iterator end() {
+            return iterator{ this, capacity() };
+        }
+
+        [[nodiscard]] const_iterator begin() const {
+            return const_iterator{ this, 0 };
+        }
+
+        [[nodiscard]] const_iterator end() const {
+            return const_iterator{ this, capacity() };
+        }
+
+        [[nodiscard]] uz size() const {
+            return mSize;
+        }
+
+        [[nodiscard]] bool empty() const {
+            return mSize == 0;
+        }
+
+        // number of slots, always a power of two (or zero before the first insertion)
+        [[nodiscard]] uz capacity() const {
+            return mSlots.size();
+        }
+
+        [[nodiscard]] double load_factor() const {
+            return (capacity() == 0 ? 0.0 : static_cast<double>(mSize) / static_cast<double>(capacity()));
+        }
+
+        // keeps the capacity
+        void clear() {
+            std::fill(mControl.begin(), mControl.end(), emptyControl);
+            mSize = 0;
+            mGrowthLeft = maxLoad(capacity());
+        }
+
+        // makes room for count elements without rehashing in between
+        void reserve(const uz count) {
+            if (count > mSize + mGrowthLeft) {
+                rehash(capacityFor(count));
+            }
+        }
+
+        // changes the capacity to at least the given one (rounded up to a power of two), also removes tombstones
+        void rehash(const uz minCapacity) {
+            const auto newCapacity = std::max(capacityFor(mSize), std::bit_ceil(std::max(minCapacity, groupSize)));
+            auto oldControl = std::move(mControl);
+            auto oldSlots = std::move(mSlots);
+            mControl.assign(newCapacity, emptyControl);
+            mSlots.clear();
+            mSlots.resize(newCapacity);
+            mGrowthLeft = maxLoad(newCapacity) - mSize;
+            for (auto i = uz{ 0 }; i < oldSlots.size(); ++i) {
+                if (oldControl[i] >= 0) {
+                    const auto hash = hashOf(keyOf(oldSlots[i]));
+                    const auto index = findEmptyOrDeleted(hash);
+                    mControl[index] = fingerprint(hash);
+                    mSlots[index] = std::move(oldSlots[i]);
+                }
+            }
+        }
+
+        [[nodiscard]] iterator find(const Key& key) {
+            const auto index = findIndex(key, hashOf(key));
+            return iterator{ this, index == notFound ? capacity() : index };
+        }
+
+        [[nodiscard]] const_iterator find(const Key& key) const {
+            const auto index = findIndex(key, hashOf(key));
+            return const_iterator{ this, index == notFound ? capacity() : index };
+        }
+
+        [[nodiscard]] bool contains(const Key& key) const {
+            return findIndex(key, hashOf(key)) != notFound;
+        }
+
+        [[nodiscard]] uz count(const Key& key) const {
+            return (contains(key) ? 1 : 0);
+        }
+
+        std::pair<iterator, bool> insert(const value_type& value) {
+            const auto [index, inserted] = findOrPrepareInsert(keyOf(value));
+            if (inserted) {
+                mSlots[index] = value;
+            }
+            return { iterator{ this, index }, inserted };
+        }
+
+        template<typename... Arguments>
+            requires(!isSet)
+        std::pair<iterator, bool> try_emplace(const Key& key, Arguments&&... arguments) {
+            const auto [index, inserted] = findOrPrepareInsert(key);
+            if (inserted) {
+                mSlots[index] = value_type{ key, Value{ std::forward<Arguments>(arguments)... } };
+            }
+            return { iterator{ this, index }, inserted };
+        }
+
+        auto& operator[](const Key& key)
+            requires(!isSet)
+        {
+            return try_emplace(key).first->second;
+        }
+
+        [[nodiscard]] const auto& at(const Key& key) const
+            requires(!isSet)
+        {
+            const auto index = findIndex(key, hashOf(key));
+            if (index == notFound) {
+                throw std::runtime_error{ "The key does not exist. " };
+            }
+            return mSlots[index].second;
+        }
+
+        uz erase(const Key& key) {
+            const auto index = findIndex(key, hashOf(key));
+            if (index == notFound) {
+                return 0;
+            }
+            eraseIndex(index);
+            return 1;
+        }
+
+        void erase(const const_iterator position) {
+            eraseIndex(position.mIndex);
+        }
+
+        template<typename Predicate>
+        friend uz erase_if(FlatPointTable& table, Predicate predicate) {
+            auto numErased = uz{ 0 };
+            for (auto i = uz{ 0 }; i < table.capacity(); ++i) {
+                if (table.mControl[i] >= 0 && predicate(std::as_const(table.mSlots[i]))) {
+                    table.eraseIndex(i);
+                    ++numErased;
+                }
+            }
+            return numErased;
+        }
+
+    private:
+        [[nodiscard]] static const Key& keyOf(const value_type& value) {
+            if constexpr (isSet) {
+                return value;
+            } else {
+                return value.first;
+            }
+        }
+
+        // the table is grown once 7/8 of the slots are used
+        [[nodiscard]] static uz maxLoad(const uz capacity) {
+            return capacity - capacity / 8;
+        }
+
+        [[nodiscard]] static uz capacityFor(const uz count) {
+            if (count == 0) {
+                return 0;
+            }
+            auto result = groupSize;
+            while (maxLoad(result) < count) {
+                result *= 2;
+            }
+            return result;
+        }
+
+        [[nodiscard]] u64 hashOf(const Key& key) const {
+            return static_cast<u64>(mHash(key));
+        }
+
+        // the lower 7 bits of the hash end up in the control byte, the remaining ones select the group
+        [[nodiscard]] static ControlByte fingerprint(const u64 hash) {
+            return static_cast<ControlByte>(hash & 0x7F);
+        }
+
+        /* Calls the visitor with the index of the first slot of every group in probing order until it returns a
+         * result. Triangular steps visit every group exactly once for a power of two number of groups. */
+        template<typename Visitor>
+        [[nodiscard]] uz probe(const u64 hash, Visitor&& visitor) const {
+            const auto groupMask = capacity() / groupSize - 1;
+            auto group = static_cast<uz>(hash >> 7) & groupMask;
+            for (auto step = uz{ 1 };; ++step) {
+                if (const auto result = visitor(group * groupSize); result.has_value()) {
+                    return *result;
+                }
+                group = (group + step) & groupMask;
+            }
+        }
+
+        [[nodiscard]] uz findIndex(const Key& key, const u64 hash) const {
+            if (mSize == 0) {
+                return notFound;
+            }
+            const auto keyFingerprint = fingerprint(hash);
+            return probe(hash, [&](const uz first) -> std::optional<uz> {
+                const auto group = ControlGroup{ &mControl[first] };
+                for (auto matches = group.match(keyFingerprint); matches != 0; matches &= matches - 1) {
+                    const auto index = first + static_cast<uz>(std::countr_zero(matches));
+                    if (keyOf(mSlots[index]) == key) {
+                        return index;
+                    }
+                }
+                // an empty slot ends the probing, the key would have been inserted there
+                if (group.matchEmpty() != 0) {
+                    return notFound;
+                }
+                return std::nullopt;
+            });
+        }
+
+        [[nodiscard]] uz findEmptyOrDeleted(const u64 hash) const {
+            return probe(hash, [&](const uz first) -> std::optional<uz> {
+                const auto available = ControlGroup{ &mControl[first] }.matchEmptyOrDeleted();
+                if (available == 0) {
+                    return std::nullopt;
+                }
+                return first + static_cast<uz>(std::countr_zero(available));
+            });
+        }
+
+        // returns the slot of the key and whether it has to be filled
+        [[nodiscard]] std::pair<uz, bool> findOrPrepareInsert(const Key& key) {
+            const auto hash = hashOf(key);
+            const auto existing = findIndex(key, hash);
+            if (existing != notFound) {
+                return { existing, false };
+            }
+            if (mGrowthLeft == 0) {
+                // deleted slots are not reused by growing, get rid of them if there are many
+                rehash(mSize < maxLoad(capacity()) / 2 ? capacity() : 2 * capacity());
+            }
+            const auto index = findEmptyOrDeleted(hash);
+            if (mControl[index] == emptyControl) {
+                --mGrowthLeft;
+            }
+            mControl[index] = fingerprint(hash);
+            ++mSize;
+            return { index, true };
+        }
+
+        void eraseIndex(const uz index) {
+            /* If the group of the slot still has an empty slot, no probe sequence went beyond it, so the slot can
+             * become empty again. Otherwise, a tombstone keeps the probe sequences going on to the next group. */
+            const auto first = index / groupSize * groupSize;
+            if (ControlGroup{ &mControl[first] }.matchEmpty() != 0) {
+                mControl[index] = emptyControl;
+                ++mGrowthLeft;
+            } else {
+                mControl[index] = deletedControl;
+            }
+            mSlots[index] = value_type{};
+            --mSize;
+        }
+
+    private:
+        std::vector<ControlByte> mControl;
+        std::vector<value_type> mSlots;
+        uz mSize{ 0 };
+        // number of insertions into empty slots until the table has to grow
+        uz mGrowthLeft{ 0 };
+        [[no_unique_address]] Hash mHash{};
+    };
+}// namespace detail
+
+template<typename Key, typename Hash = Murmur3Hasher<Key>>
+using FlatPointSet = detail::FlatPointTable<Key, void, Hash>;
+
+template<typename Key, typename Value, typename Hash = Murmur3Hasher<Key>>
+using FlatPointMap = detail::FlatPointTable<Key, Value, Hash>;
@@ -0,0 +1,155 @@
+#pragma once
+
+#include "AOCUtilities.hpp"
+#include <algorithm>
+#include <concepts>
+#include <span>
+#include <stdexcept>
+#include <type_traits>
+#include <vector>
+
+/* Dense two-dimensional grid stored row by row. The grid can be surrounded by padding cells (ghost cells)
+ * on all four sides, which can be read and written like any other cell. Filled with a neutral value they
+ * let neighbor lookups at the border skip the bounds checks, e.g. with a padding of 1 the four neighbors of
+ * every cell are valid coordinates.
+ *
+ * operator() is unchecked (asserted in debug builds) and accepts coordinates from -padding() up to
+ * width() + padding() - 1, at() only accepts the inner cells and throws otherwise. Unsigned coordinates
+ * like x - 1 for x = 0 wrap around to the padding just like signed ones. */
+template<typename T>
+class Grid {
+    static_assert(!std::is_same_v<T, bool>, "std::vector<bool> has no contiguous storage, use u8. ");
+
+public:
+    Grid() = default;
+
+    // every cell including the padding is set to the value
+    Grid(const uz width, const uz height, const T& value = T{}, const uz padding = 0)
+        : mWidth{ width },
+          mHeight{ height },
+          mPadding{ padding },
+          mStride{ width + 2 * padding },
+          mCells((height + 2 * padding) * (width + 2 * padding), value) { }
+
+    [[nodiscard]] uz width() const {
+        return mWidth;
+    }
+
+    [[nodiscard]] uz height() const {
+        return mHeight;
+    }
+
+    [[nodiscard]] uz padding() const {
+        return mPadding;
+    }
+
+    // distance between vertically adjacent cells in the storage, i.e. the index offset of the cell below
+    [[nodiscard]] uz stride() const {
+        return mStride;
+    }
+
+    // whether the coordinates are an inner cell, i.e. not part of the padding
+    [[nodiscard]] bool contains(const std::integral auto x, const std::integral auto y) const {
+        return std::in_range<uz>(x) && std::in_range<uz>(y) && static_cast<uz>(x) < mWidth &&
+               static_cast<uz>(y) < mHeight;
+    }
+
+    // the index of the cell in cells(), neighbors are +-1 and +-stride() away
+    [[nodiscard]] uz indexOf(const std::integral auto x, const std::integral auto y) const {
+        // computed modulo 2^64, so negative and wrapped around coordinates work the same
+        const auto index = (static_cast<uz>(y) + mPadding) * mStride + static_cast<uz>(x) + mPadding;
+        assert(index < mCells.size());
+        return index;
+    }
+
+    [[nodiscard]] T& operator()(const std::integral auto x, const std::integral auto y) {
+        return mCells[indexOf(x, y)];
+    }
+
+    [[nodiscard]] const T& operator()(const std::integral auto x, const std::integral auto y) const {
+        return mCells[indexOf(x, y)];
+    }
+
+    template<std::integral I>
+    [[nodiscard]] T& operator()(const Point<I> point) {
+        return (*this)(point.x, point.y);
+    }
+
+    template<std::integral I>
+    [[nodiscard]] const T& operator()(const Point<I> point) const {
+        return (*this)(point.x, point.y);
+    }
+
+    [[nodiscard]] T& at(const std::integral auto x, const std::integral auto y) {
+        if (!contains(x, y)) {
+            throw std::runtime_error{ "Coordinates outside of the grid. " };
+        }
+        return (*this)(x, y);
+    }
+
+    [[nodiscard]] const T& at(const std::integral auto x, const std::integral auto y) const {
+        if (!contains(x, y)) {
+            throw std::runtime_error{ "Coordinates outside of the grid. " };
+        }
+        return (*this)(x, y);
+    }
+
+    // unchecked access by the index of indexOf()
+    [[nodiscard]] T& operator[](const uz index) {
+        assert(index < mCells.size());
+        return mCells[index];
+    }
+
+    [[nodiscard]] const T& operator[](const uz index) const {
+        assert(index < mCells.size());
+        return mCells[index];
+    }
+
+    // the inner cells of a row, contiguous for vectorized loops
+    [[nodiscard]] std::span<T> row(const uz y) {
+        return std::span<T>{ mCells }.subspan(indexOf(uz{ 0 }, y), mWidth);
+    }
+
+    [[nodiscard]] std::span<const T> row(const uz y) const {
+        return std::span<const T>{ mCells }.subspan(indexOf(uz{ 0 }, y), mWidth);
+    }
+
+    // all cells including the padding
+    [[nodiscard]] std::span<T> cells() {
+        return mCells;
+    }
+
+    [[nodiscard]] std::span<const T> cells() const {
+        return mCells;
+    }
+
+    // sets the inner cells to the value
+    void fill(const T& value) {
+        for (auto y = uz{ 0 }; y < mHeight; ++y) {
+            std::ranges::fill(row(y), value);
+        }
+    }
+
+    // sets the padding cells to the value
+    void fillPadding(const T& value) {
+        const auto numRows = mHeight + 2 * mPadding;
+        for (auto y = uz{ 0 }; y < numRows; ++y) {
+            const auto rowCells = std::span<T>{ mCells }.subspan(y * mStride, mStride);
+            if (y < mPadding || y >= mPadding + mHeight) {
+                std::ranges::fill(rowCells, value);
+            } else {
+                std::ranges::fill(rowCells.first(mPadding), value);
+                std::ranges::fill(rowCells.last(mPadding), value);
+            }
+        }
+    }
+
+    [[nodiscard]] bool operator==(const Grid&) const = default;
+
+private:
+    uz mWidth{ 0 };
+    uz mHeight{ 0 };
+    uz mPadding{ 0 };
+    uz mStride{ 0 };
+    std::vector<T> mCells;
+};
@@ -0,0 +1,106 @@
+#pragma once
+
+#include "AOCUtilities.hpp"
+#include <algorithm>
+#include <ostream>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <vector>
+
+/* Renders two-dimensional data as text, composing whole frames in a buffer that is written with a single
+ * write() instead of one formatted ostream insertion per cell. The buffer is kept between frames, so a renderer
+ * that dumps every step of a simulation allocates only for the first one.
+ *
+ * cells() writes every cell, glyph(x, y) returns a char or a string_view (e.g. "■"). summary() downsamples
+ * grids that are too large to look at: every character stands for a block of cells and shows the mean of
+ * density(x, y), a value from 0 to 1, on the ramp " .:-=+*#%@".
+ *
+ *     GridRenderer{ width, height }.cells([&](const uz x, const uz y) { return grid(x, y) ? '#' : '.'; })
+ *                                  .write(std::cout);
+ */
+class GridRenderer {
+public:
+    static constexpr auto densityRamp = std::string_view{ " .:-=+*#%@" };
+
+    GridRenderer(const uz width, const uz height) : mWidth{ width }, mHeight{ height } { }
+
+    [[nodiscard]] uz width() const {
+        return mWidth;
+    }
+
+    [[nodiscard]] uz height() const {
+        return mHeight;
+    }
+
+    // whether cells() fits into maxColumns x maxRows characters
+    [[nodiscard]] bool fits(const uz maxColumns, const uz maxRows) const {
+        return mWidth <= maxColumns && mHeight <= maxRows;
+    }
+
+    template<typename Glyph>
+    GridRenderer& cells(Glyph&& glyph) {
+        mText.clear();
+        for (auto y = uz{ 0 }; y < mHeight; ++y) {
+            for (auto x = uz{ 0 }; x < mWidth; ++x) {
+                const auto cell = glyph(x, y);
+                if constexpr (std::is_same_v<std::remove_cvref_t<decltype(cell)>, char>) {
+                    mText.push_back(cell);
+                } else {
+                    mText.append(std::string_view{ cell });
+                }
+            }
+            mText.push_back('\n');
+            if (y == 0) {
+                // every row is about as long as the first one
+                mText.reserve(mText.size() * mHeight);
+            }
+        }
+        return *this;
+    }
+
+    // at most maxColumns x maxRows characters, blocks of a single cell if the grid fits
+    template<typename Density>
+    GridRenderer& summary(const uz maxColumns, const uz maxRows, Density&& density) {
+        const auto blockWidth = std::max(uz{ 1 }, (mWidth + maxColumns - 1) / std::max(maxColumns, uz{ 1 }));
+        const auto blockHeight = std::max(uz{ 1 }, (mHeight + maxRows - 1) / std::max(maxRows, uz{ 1 }));
+        const auto numColumns = (mWidth + blockWidth - 1) / blockWidth;
+        mText.clear();
+        mText.reserve(((mHeight + blockHeight - 1) / blockHeight) * (numColumns + 1));
+        mSums.assign(numColumns, 0.0);
+        for (auto blockY = uz{ 0 }; blockY < mHeight; blockY += blockHeight) {
+            const auto blockEndY = std::min(blockY + blockHeight, mHeight);
+            // row by row through the cells, summed up per block column
+            std::fill(mSums.begin(), mSums.end(), 0.0);
+            for (auto y = blockY; y < blockEndY; ++y) {
+                for (auto x = uz{ 0 }; x < mWidth; ++x) {
+                    mSums[x / blockWidth] += static_cast<double>(density(x, y));
+                }
+            }
+            for (auto column = uz{ 0 }; column < numColumns; ++column) {
+                const auto numCells = (std::min((column + 1) * blockWidth, mWidth) - column * blockWidth) *
+                                      (blockEndY - blockY);
+                const auto mean = std::clamp(mSums[column] / static_cast<double>(numCells), 0.0, 1.0);
+                const auto level = static_cast<uz>(mean * static_cast<double>(densityRamp.size() - 1) + 0.5);
+                mText.push_back(densityRamp[level]);
+            }
+            mText.push_back('\n');
+        }
+        return *this;
+    }
+
+    // the last frame
+    [[nodiscard]] const std::string& text() const {
+        return mText;
+    }
+
+    void write(std::ostream& ostream) const {
+        ostream.write(mText.data(), static_cast<std::streamsize>(mText.size()));
+    }
+
+private:
+    uz mWidth;
+    uz mHeight;
+    std::string mText;
+    std::vector<double> mSums;
+};
@@ -0,0 +1,282 @@
+#pragma once
+
+#include "AOCUtilities.hpp"
+#include "ThreadPool.hpp"
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <functional>
+#include <numeric>
+#include <span>
+#include <vector>
+
+/* Selection and median estimation beyond median() of AOCUtilities.hpp: a parallel selection for very large
+ * vectors, an exact median of a stream of values and a constant memory approximation of it. */
+
+namespace detail {
+    // below this size the sequential std::nth_element beats the extra passes of the parallel partitioning
+    constexpr auto parallelSelectionThreshold = uz{ 1 } << 18;
+    // guards against pivots that keep hitting the edge of the range, the rest is selected sequentially
+    constexpr auto maxParallelSelectionRounds = 64;
+
+    template<typename T>
+    [[nodiscard]] const T& medianOfThree(const T& a, const T& b, const T& c) {
+        if (a < b) {
+            return (b < c) ? b : ((a < c) ? c : a);
+        }
+        return (a < c) ? a : ((b < c) ? c : b);
+    }
+
+    // Tukey's ninther of samples spread over the whole range
+    template<typename T>
+    [[nodiscard]] T selectPivot(const std::span<const T> values) {
+        const auto step = values.size() / 9;
+        auto medians = std::array<T, 3>{};
+        for (auto i = uz{ 0 }; i < 3; ++i) {
+            const auto offset = 3 * i * step;
+            medians[i] = medianOfThree(values[offset], values[offset + step], values[offset + 2 * step]);
+        }
+        return medianOfThree(medians[0], medians[1], medians[2]);
+    }
+}// namespace detail
+
+/* Rearranges the values like std::nth_element. While the range that contains the n-th value is large, every
+ * thread counts the values of its chunk below and equal to a pivot and then scatters them into a scratch
+ * buffer at the offsets given by the prefix sums of the counts, which is copied back in parallel as well.
+ * The chunks run on threadPool(), numThreads = 0 makes one chunk per thread of the pool. */
+template<typename T>
+void parallelNthElement(const std::span<T> values, const uz n, uz numThreads = 0) {
+    assert(n < values.size());
+    if (numThreads == 0) {
+        numThreads = threadPool().numThreads();
+    }
+    auto first = uz{ 0 };
+    auto last = values.size();
+    auto scratch = std::vector<T>{};
+    for (auto round = 0; round < detail::maxParallelSelectionRounds && numThreads > 1 &&
+                         last - first > detail::parallelSelectionThreshold;
+         ++round) {
+        const auto range = values.subspan(first, last - first);
+        const auto pivot = detail::selectPivot(std::span<const T>{ range });
+        scratch.resize(range.size());
+
+        struct Counts {
+            uz numLess;
+            uz numEqual;
+            uz numGreater;
+        };
+        auto counts = std::vector<Counts>(numThreads, Counts{ 0, 0, 0 });
+        detail::forEachChunk(uz{ 0 }, range.size(), numThreads, [&](const uz thread, const uz begin, const uz end) {
+            auto chunkCounts = Counts{ 0, 0, 0 };
+            for (auto i = begin; i < end; ++i) {
+                chunkCounts.numLess += (range[i] < pivot ? 1 : 0);
+                chunkCounts.numGreater += (pivot < range[i] ? 1 : 0);
+            }
+            chunkCounts.numEqual = (end - begin) - chunkCounts.numLess - chunkCounts.numGreater;
+            counts[thread] = chunkCounts;
+        });
+        const auto numLess = std::accumulate(counts.begin(), counts.end(), uz{ 0 },
+                                             [](const uz sum, const Counts& chunk) { return sum + chunk.numLess; });
+        const auto numEqual = std::accumulate(counts.begin(), counts.end(), uz{ 0 },
+                                              [](const uz sum, const Counts& chunk) { return sum + chunk.numEqual; });
+
+        detail::forEachChunk(uz{ 0 }, range.size(), numThreads, [&](const uz thread, const uz begin, const uz end) {
+            // this chunk's offsets into the three parts are the counts of the chunks before it
+            auto lessOffset = uz{ 0 };
+            auto equalOffset = numLess;
+            auto greaterOffset = numLess + numEqual;
+            for (auto previous = uz{ 0 }; previous < thread; ++previous) {
+                lessOffset += counts[previous].numLess;
+                equalOffset += counts[previous].numEqual;
+                greaterOffset += counts[previous].numGreater;
+            }
+            for (auto i = begin; i < end; ++i) {
+                if (range[i] < pivot) {
+                    scratch[lessOffset++] = range[i];
+                } else if (pivot < range[i]) {
+                    scratch[greaterOffset++] = range[i];
+                } else {
+                    scratch[equalOffset++] = range[i];
+                }
+            }
+        });
+        detail::forEachChunk(uz{ 0 }, range.size(), numThreads, [&](const uz, const uz begin, const uz end) {
+            std::copy(scratch.begin() + static_cast<std::ptrdiff_t>(begin),
+                      scratch.begin() + static_cast<std::ptrdiff_t>(end),
+                      range.begin() + static_cast<std::ptrdiff_t>(begin));
+        });
+
+        if (n < first + numLess) {
+            last = first + numLess;
+        } else if (n < first + numLess + numEqual) {
+            return;
+        } else {
+            first += numLess + numEqual;
+        }
+    }
+    std::nth_element(values.begin() + static_cast<std::ptrdiff_t>(first),
+                     values.begin() + static_cast<std::ptrdiff_t>(n),
+                     values.begin() + static_cast<std::ptrdiff_t>(last));
+}
+
+// median() of AOCUtilities.hpp with the selection split between the threads
+template<typename T>
+[[nodiscard]] T parallelMedian(const std::span<T> values, const uz numThreads = 0) {
+    assert(!values.empty());
+    const auto middle = values.size() / 2;
+    parallelNthElement(values, middle, numThreads);
+    if (values.size() % 2 == 1) {
+        return values[middle];
+    }
+    return std::midpoint(*std::max_element(values.begin(), values.begin() + static_cast<std::ptrdiff_t>(middle)),
+                         values[middle]);
+}
+
+template<typename T>
+[[nodiscard]] T parallelMedian(std::vector<T>& values, const uz numThreads = 0) {
+    return parallelMedian(std::span<T>{ values }, numThreads);
+}
+
+/* Exact median of the values pushed so far, kept as a max heap of the lower half and a min heap of the upper
+ * half. A push is O(log n) and the median is available at any time, so the values never have to be collected
+ * and selected at once. Same rounding as median(). */
+template<typename T>
+class StreamingMedian {
+public:
+    void reserve(const uz size) {
+        mLower.reserve(size / 2 + 1);
+        mUpper.reserve(size / 2 + 1);
+    }
+
+    void push(const T& value) {
+        if (mLower.empty() || !(mLower.front() < value)) {
+            pushHeap(mLower, value, std::less<T>{});
+        } else {
+            pushHeap(mUpper, value, std::greater<T>{});
+        }
+        // the lower half holds the middle value for an odd number of values
+        if (mLower.size() > mUpper.size() + 1) {
+            pushHeap(mUpper, popHeap(mLower, std::less<T>{}), std::greater<T>{});
+        } else if (mUpper.size() > mLower.size()) {
+            pushHeap(mLower, popHeap(mUpper, std::greater<T>{}), std::less<T>{});
+        }
+    }
+
+    [[nodiscard]] T median() const {
+        if (mLower.empty()) {
+            throw std::runtime_error{ "Median of no values. " };
+        }
+        if (mLower.size() > mUpper.size()) {
+            return mLower.front();
+        }
+        return std::midpoint(mLower.front(), mUpper.front());
+    }
+
+    [[nodiscard]] uz size() const {
+        return mLower.size() + mUpper.size();
+    }
+
+    [[nodiscard]] bool empty() const {
+        return mLower.empty();
+    }
+
+private:
+    template<typename Compare>
+    static void pushHeap(std::vector<T>& heap, const T& value, const Compare compare) {
+        heap.push_back(value);
+        std::push_heap(heap.begin(), heap.end(), compare);
+    }
+
+    template<typename Compare>
+    [[nodiscard]] static T popHeap(std::vector<T>& heap, const Compare compare) {
+        std::pop_heap(heap.begin(), heap.end(), compare);
+        const auto value = heap.back();
+        heap.pop_back();
+        return value;
+    }
+
+    std::vector<T> mLower;// max heap
+    std::vector<T> mUpper;// min heap
+};
+
+/* Approximate median in constant memory with the P² algorithm (Jain and Chlamtac, 1985): five markers track
+ * the minimum, the quartiles, the median and the maximum, and the inner markers are moved towards their
+ * desired positions with a piecewise parabolic interpolation. Exact for up to five values. */
+class ApproximateMedian {
+public:
+    void push(const double value) {
+        if (mCount < numMarkers) {
+            mHeights[mCount++] = value;
+            std::sort(mHeights.begin(), mHeights.begin() + static_cast<std::ptrdiff_t>(mCount));
+            return;
+        }
+        ++mCount;
+
+        // the cell the value falls into, extending the extreme markers if necessary
+        auto cell = uz{ 0 };
+        if (value < mHeights[0]) {
+            mHeights[0] = value;
+        } else if (value >= mHeights[4]) {
+            mHeights[4] = value;
+            cell = 3;
+        } else {
+            while (value >= mHeights[cell + 1]) {
+                ++cell;
+            }
+        }
+        for (auto i = cell + 1; i < numMarkers; ++i) {
+            ++mPositions[i];
+        }
+        for (auto i = uz{ 0 }; i < numMarkers; ++i) {
+            mDesiredPositions[i] += desiredIncrements[i];
+        }
+
+        for (auto i = uz{ 1 }; i < numMarkers - 1; ++i) {
+            const auto offset = mDesiredPositions[i] - mPositions[i];
+            if ((offset >= 1.0 && mPositions[i + 1] - mPositions[i] > 1.0) ||
+                (offset <= -1.0 && mPositions[i - 1] - mPositions[i] < -1.0)) {
+                const auto direction = std::copysign(1.0, offset);
+                const auto height = parabolic(i, direction);
+                mHeights[i] = (mHeights[i - 1] < height && height < mHeights[i + 1]) ? height : linear(i, direction);
+                mPositions[i] += direction;
+            }
+        }
+    }
+
+    [[nodiscard]] double median() const {
+        if (mCount == 0) {
+            throw std::runtime_error{ "Median of no values. " };
+        }
+        if (mCount < numMarkers) {
+            return (mCount % 2 == 1) ? mHeights[mCount / 2]
+                                     : (mHeights[mCount / 2 - 1] + mHeights[mCount / 2]) / 2.0;
+        }
+        return mHeights[2];
+    }
+
+    [[nodiscard]] uz size() const {
+        return mCount;
+    }
+
+private:
+    static constexpr auto numMarkers = uz{ 5 };
+    static constexpr auto desiredIncrements = std::array{ 0.0, 0.25, 0.5, 0.75, 1.0 };
+
+    [[nodiscard]] double parabolic(const uz i, const double direction) const {
+        const auto& q = mHeights;
+        const auto& n = mPositions;
+        return q[i] + direction / (n[i + 1] - n[i - 1]) *
+                              ((n[i] - n[i - 1] + direction) * (q[i + 1] - q[i]) / (n[i + 1] - n[i]) +
+                               (n[i + 1] - n[i] - direction) * (q[i] - q[i - 1]) / (n[i] - n[i - 1]));
+    }
+
+    [[nodiscard]] double linear(const uz i, const double direction) const {
+        const auto neighbor = (direction > 0.0) ? i + 1 : i - 1;
+        return mHeights[i] + direction * (mHeights[neighbor] - mHeights[i]) / (mPositions[neighbor] - mPositions[i]);
+    }
+
+    uz mCount{ 0 };
+    std::array<double, numMarkers> mHeights{};
+    std::array<double, numMarkers> mPositions{ 1.0, 2.0, 3.0, 4.0, 5.0 };
+    std::array<double, numMarkers> mDesiredPositions{ 1.0, 2.0, 3.0, 4.0, 5.0 };
+};
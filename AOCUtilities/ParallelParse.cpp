@@ -0,0 +1,23 @@
+#include "ParallelParse.hpp"
+
+std::vector<std::string_view> splitIntoChunks(const std::string_view text,
+                                              const uz numChunks,
+                                              const std::string_view separator) {
+    auto chunks = std::vector<std::string_view>{};
+    auto begin = uz{ 0 };
+    for (auto chunk = uz{ 1 }; chunk < numChunks && begin < text.size(); ++chunk) {
+        // the separator may start before the target, as long as it ends after the beginning of the chunk
+        const auto target = std::max(text.size() * chunk / numChunks, begin + separator.size()) - separator.size();
+        const auto position = text.find(separator, target);
+        if (position == std::string_view::npos) {
+            break;
+        }
+        const auto end = position + separator.size();
+        chunks.push_back(text.substr(begin, end - begin));
+        begin = end;
+    }
+    if (begin < text.size()) {
+        chunks.push_back(text.substr(begin));
+    }
+    return chunks;
+}
@@ -0,0 +1,65 @@
+#pragma once
+
+#include "AOCUtilities.hpp"
+#include "ThreadPool.hpp"
+#include <algorithm>
+#include <iterator>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+/* Parses large inputs on all threads of the pool. The text is split into chunks that end right after a
+ * separator (a newline, or the blank line between blocks of records), every chunk is parsed by a callback into a
+ * vector of its own and the vectors are concatenated in the order of the chunks. Texts too small to give every
+ * chunk minParallelChunkBytes are parsed as a single chunk on the calling thread, so the puzzle inputs of a few
+ * KiB pay nothing for it.
+ *
+ *     const auto instructions = parseChunked<Instruction>(input, [](const std::string_view chunk, auto& output) {
+ *         for (const auto line : splitLines(chunk)) {
+ *             output.push_back(parseLine(line));
+ *         }
+ *     });
+ *
+ * Records that are merged instead of concatenated can be folded with parallelReduce() over the chunks of
+ * splitIntoChunks(). */
+constexpr auto minParallelChunkBytes = uz{ 1 } << 16;
+
+/* At most numChunks consecutive, non-empty pieces of the text, every piece but the last ending right after an
+ * occurrence of the separator. The pieces are about equally large unless the separators are far apart. */
+[[nodiscard]] std::vector<std::string_view> splitIntoChunks(std::string_view text,
+                                                            uz numChunks,
+                                                            std::string_view separator = "\n");
+
+// the number of chunks to parse a text of the given size in, 1 if it is too small to be worth splitting
+[[nodiscard]] inline uz numParseChunks(const uz size, const ThreadPool& pool = threadPool()) {
+    return std::max(uz{ 1 }, std::min(detail::numChunks(size, pool), size / minParallelChunkBytes));
+}
+
+// parseChunk(chunk, output) appends the records of the chunk to the std::vector<T> output
+template<typename T, typename ParseChunk>
+[[nodiscard]] std::vector<T> parseChunked(const std::string_view text,
+                                          ParseChunk&& parseChunk,
+                                          const std::string_view separator = "\n",
+                                          ThreadPool& pool = threadPool()) {
+    const auto chunks = splitIntoChunks(text, numParseChunks(text.size(), pool), separator);
+    if (chunks.size() <= 1) {
+        auto result = std::vector<T>{};
+        parseChunk(text, result);
+        return result;
+    }
+    auto outputs = std::vector<std::vector<T>>(chunks.size());
+    detail::forEachChunk(uz{ 0 }, chunks.size(), chunks.size(),
+                         [&](const uz chunk, const uz, const uz) { parseChunk(chunks[chunk], outputs[chunk]); },
+                         pool);
+    auto size = uz{ 0 };
+    for (const auto& output : outputs) {
+        size += output.size();
+    }
+    auto result = std::move(outputs.front());
+    result.reserve(size);
+    for (auto chunk = uz{ 1 }; chunk < outputs.size(); ++chunk) {
+        result.insert(result.end(), std::make_move_iterator(outputs[chunk].begin()),
+                      std::make_move_iterator(outputs[chunk].end()));
+    }
+    return result;
+}
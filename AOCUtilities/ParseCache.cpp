@@ -0,0 +1,122 @@
+#include "ParseCache.hpp"
+#include <array>
+#include <fstream>
+#include <system_error>
+
+namespace {
+    constexpr auto magic = std::array<char, 8>{ 'A', 'O', 'C', 'P', 'A', 'R', 'S', 'E' };
+
+    struct Header {
+        std::array<char, 8> magic;
+        u32 containerVersion;
+        u32 payloadVersion;
+        u64 sourceSize;
+        u64 sourceHash;
+        u64 payloadSize;
+        u64 payloadHash;
+    };
+    static_assert(sizeof(Header) == 48, "The header layout is part of the documented format. ");
+
+    [[nodiscard]] std::span<const std::byte> asBytes(const std::string_view text) {
+        return std::as_bytes(std::span{ text.data(), text.size() });
+    }
+
+    [[nodiscard]] u64 loadWord(const std::byte* const bytes) {
+        auto word = u64{};
+        std::memcpy(&word, bytes, sizeof(word));
+        return word;
+    }
+}// namespace
+
+u64 hashBytes(const std::span<const std::byte> bytes) {
+    constexpr auto secret0 = u64{ 0xa0761d6478bd642fULL };
+    constexpr auto secret1 = u64{ 0xe7037ed1a0b428dbULL };
+    constexpr auto secret2 = u64{ 0x8ebc6af09c88c6e3ULL };
+    constexpr auto secret3 = u64{ 0x589965cc75374cc3ULL };
+    // independent lanes, so the multiplications of consecutive words overlap
+    auto lanes = std::array{ secret0, secret1, secret2, secret3 ^ bytes.size() };
+    auto offset = uz{ 0 };
+    for (; offset + 32 <= bytes.size(); offset += 32) {
+        for (auto lane = uz{ 0 }; lane < lanes.size(); ++lane) {
+            lanes[lane] = wyMix(loadWord(bytes.data() + offset + 8 * lane) ^ secret0, lanes[lane] ^ secret1);
+        }
+    }
+    auto result = wyMix(lanes[0] ^ lanes[2], lanes[1] ^ lanes[3]);
+    for (; offset < bytes.size(); offset += 8) {
+        auto word = u64{ 0 };
+        std::memcpy(&word, bytes.data() + offset, std::min(uz{ 8 }, bytes.size() - offset));
+        result = wyMix(word ^ secret0, result ^ secret2);
+    }
+    return wyMix(result ^ secret3, static_cast<u64>(bytes.size()) ^ secret1);
+}
+
+std::filesystem::path parseCachePath(const std::filesystem::path& inputPath) {
+    auto result = inputPath;
+    result += ".bin";
+    return result;
+}
+
+std::span<const std::byte> CachedPayload::bytes() const {
+    return asBytes(mFile.contents()).subspan(sizeof(Header));
+}
+
+std::optional<CachedPayload> loadParseCache(const std::filesystem::path& inputPath,
+                                            const std::string_view input,
+                                            const u32 version) {
+    const auto path = parseCachePath(inputPath);
+    auto error = std::error_code{};
+    if (!std::filesystem::exists(path, error)) {
+        return std::nullopt;
+    }
+    auto file = MappedInput{ path.string(), MappedInput::LineIndex::Skip };
+    const auto contents = asBytes(file.contents());
+    if (contents.size() < sizeof(Header)) {
+        return std::nullopt;
+    }
+    auto header = Header{};
+    std::memcpy(&header, contents.data(), sizeof(Header));
+    const auto payload = contents.subspan(sizeof(Header));
+    // the cheap checks first, the source is only hashed if everything else matches
+    if (header.magic != magic || header.containerVersion != parseCacheContainerVersion ||
+        header.payloadVersion != version || header.sourceSize != input.size() ||
+        header.payloadSize != payload.size() || header.sourceHash != hashBytes(asBytes(input)) ||
+        header.payloadHash != hashBytes(payload)) {
+        return std::nullopt;
+    }
+    return CachedPayload{ std::move(file) };
+}
+
+bool storeParseCache(const std::filesystem::path& inputPath,
+                     const std::string_view input,
+                     const u32 version,
+                     const std::span<const std::byte> payload) {
+    const auto header = Header{ magic,
+                                parseCacheContainerVersion,
+                                version,
+                                input.size(),
+                                hashBytes(asBytes(input)),
+                                payload.size(),
+                                hashBytes(payload) };
+    const auto path = parseCachePath(inputPath);
+    // written next to the sidecar and renamed, so concurrent runs never see a partial file
+    auto temporaryPath = path;
+    temporaryPath += ".tmp";
+    {
+        auto file = std::ofstream{ temporaryPath, std::ios::binary | std::ios::trunc };
+        if (!file) {
+            return false;
+        }
+        file.write(reinterpret_cast<const char*>(&header), sizeof(header));
+        file.write(reinterpret_cast<const char*>(payload.data()), static_cast<std::streamsize>(payload.size()));
+        if (!file) {
+            return false;
+        }
+    }
+    auto error = std::error_code{};
+    std::filesystem::rename(temporaryPath, path, error);
+    if (error) {
+        std::filesystem::remove(temporaryPath, error);
+        return false;
+    }
+    return true;
+}
@@ -0,0 +1,165 @@
+#pragma once
+
+#include "AOCUtilities.hpp"
+#include <cstddef>
+#include <filesystem>
+#include <functional>
+#include <optional>
+#include <span>
+#include <string_view>
+#include <type_traits>
+#include <vector>
+
+/* Binary sidecar files caching the parsed representation of an input, e.g. input.txt.bin next to input.txt.
+ * A day opts in with a ParseCacheFormat: a serialize function writing its parsed input to a BinaryWriter, a
+ * deserialize function reading it back from a BinaryReader and the version of that layout. Later runs map the
+ * sidecar and deserialize it instead of parsing the text, as long as the size and the hash of the text match.
+ *
+ * Layout of a sidecar, every value in the byte order of the machine that wrote it:
+ *
+ *     offset  size  field
+ *          0     8  magic "AOCPARSE"
+ *          8     4  version of this container format (parseCacheContainerVersion)
+ *         12     4  version of the day's payload layout (ParseCacheFormat::version)
+ *         16     8  size of the source text in bytes
+ *         24     8  hashBytes() of the source text
+ *         32     8  size of the payload in bytes
+ *         40     8  hashBytes() of the payload
+ *         48        payload
+ *
+ * A sidecar with a different magic, either version, a mismatching source or a broken payload hash is ignored
+ * and written again (caches of machines with the other byte order fail the version check). The payload is a
+ * sequence of BinaryWriter::write() values and writeSpan() arrays, the latter prefixed by their u64 length;
+ * every day documents its sequence next to its serialize function. */
+
+constexpr auto parseCacheContainerVersion = u32{ 1 };
+
+// 64 bit hash of arbitrary bytes, four independent wyMix lanes of 8 byte words
+[[nodiscard]] u64 hashBytes(std::span<const std::byte> bytes);
+
+class BinaryWriter {
+public:
+    template<typename T>
+        requires std::is_trivially_copyable_v<T>
+    void write(const T& value) {
+        const auto* const bytes = reinterpret_cast<const std::byte*>(&value);
+        mBytes.insert(mBytes.end(), bytes, bytes + sizeof(T));
+    }
+
+    // the number of values as u64, followed by the values
+    template<typename T>
+        requires std::is_trivially_copyable_v<T>
+    void writeSpan(const std::span<const T> values) {
+        write(static_cast<u64>(values.size()));
+        const auto bytes = std::as_bytes(values);
+        mBytes.insert(mBytes.end(), bytes.begin(), bytes.end());
+    }
+
+    [[nodiscard]] std::span<const std::byte> bytes() const {
+        return mBytes;
+    }
+
+private:
+    std::vector<std::byte> mBytes;
+};
+
+// reads what a BinaryWriter wrote, in the same order, throwing when reading past the end
+class BinaryReader {
+public:
+    explicit BinaryReader(const std::span<const std::byte> bytes) : mRemaining{ bytes } { }
+
+    template<typename T>
+        requires std::is_trivially_copyable_v<T>
+    [[nodiscard]] T read() {
+        auto value = T{};
+        std::memcpy(&value, take(sizeof(T)).data(), sizeof(T));
+        return value;
+    }
+
+    template<typename T>
+        requires std::is_trivially_copyable_v<T>
+    [[nodiscard]] std::vector<T> readVector() {
+        const auto size = read<u64>();
+        if (size > mRemaining.size() / sizeof(T)) {
+            throw std::runtime_error{ "Parse cache array exceeds the payload. " };
+        }
+        auto values = std::vector<T>(static_cast<uz>(size));
+        const auto bytes = take(values.size() * sizeof(T));
+        if (!bytes.empty()) {
+            std::memcpy(values.data(), bytes.data(), bytes.size());
+        }
+        return values;
+    }
+
+    [[nodiscard]] bool atEnd() const {
+        return mRemaining.empty();
+    }
+
+private:
+    [[nodiscard]] std::span<const std::byte> take(const uz size) {
+        if (size > mRemaining.size()) {
+            throw std::runtime_error{ "Unexpected end of the parse cache payload. " };
+        }
+        const auto result = mRemaining.first(size);
+        mRemaining = mRemaining.subspan(size);
+        return result;
+    }
+
+    std::span<const std::byte> mRemaining;
+};
+
+template<typename Parsed>
+struct ParseCacheFormat {
+    u32 version;// bump whenever the serialized layout changes
+    void (*serialize)(const Parsed& parsed, BinaryWriter& writer);
+    Parsed (*deserialize)(BinaryReader& reader);
+};
+
+// the sidecar of an input file, the path with ".bin" appended
+[[nodiscard]] std::filesystem::path parseCachePath(const std::filesystem::path& inputPath);
+
+// a mapped sidecar whose header matches the source text and the payload version
+class CachedPayload {
+public:
+    explicit CachedPayload(MappedInput file) : mFile{ std::move(file) } { }
+
+    [[nodiscard]] std::span<const std::byte> bytes() const;
+
+private:
+    MappedInput mFile;
+};
+
+[[nodiscard]] std::optional<CachedPayload> loadParseCache(const std::filesystem::path& inputPath,
+                                                          std::string_view input,
+                                                          u32 version);
+
+// writes the sidecar next to the input, returns false if it could not be written (the cache is optional)
+bool storeParseCache(const std::filesystem::path& inputPath,
+                     std::string_view input,
+                     u32 version,
+                     std::span<const std::byte> payload);
+
+/* Deserializes the sidecar of the input if it is up to date, otherwise parses the input and writes the sidecar.
+ * The text is always needed to check the sidecar against it, but hashing it is much cheaper than parsing it. */
+template<typename Parse, typename Parsed = std::invoke_result_t<Parse, std::string_view>>
+[[nodiscard]] Parsed parseWithCache(const std::filesystem::path& inputPath,
+                                    const std::string_view input,
+                                    Parse&& parse,
+                                    const ParseCacheFormat<Parsed>& format) {
+    if (const auto cached = loadParseCache(inputPath, input, format.version)) {
+        try {
+            auto reader = BinaryReader{ cached->bytes() };
+            auto parsed = format.deserialize(reader);
+            if (reader.atEnd()) {
+                return parsed;
+            }
+        } catch (const std::runtime_error&) {
+            // a layout change without a new version, the sidecar is replaced below
+        }
+    }
+    auto parsed = std::invoke(std::forward<Parse>(parse), input);
+    auto writer = BinaryWriter{};
+    format.serialize(parsed, writer);
+    storeParseCache(inputPath, input, format.version, writer.bytes());
+    return parsed;
+}
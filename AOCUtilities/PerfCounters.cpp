@@ -0,0 +1,191 @@
+#include "PerfCounters.hpp"
+#include <algorithm>
+#include <cerrno>
+#include <cstring>
+
+#if defined(__linux__)
+#include <linux/perf_event.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+std::string_view perfEventName(const PerfEvent event) {
+    switch (event) {
+        case PerfEvent::Cycles:
+            return "cycles";
+        case PerfEvent::Instructions:
+            return "instructions";
+        case PerfEvent::L1DataMisses:
+            return "L1d misses";
+        case PerfEvent::LastLevelCacheMisses:
+            return "LLC misses";
+        case PerfEvent::BranchMisses:
+            return "branch misses";
+    }
+    return "unknown";
+}
+
+std::optional<double> PerfCounts::ipc() const {
+    const auto cycles = (*this)[PerfEvent::Cycles];
+    const auto instructions = (*this)[PerfEvent::Instructions];
+    if (!cycles || !instructions || *cycles == 0.0) {
+        return std::nullopt;
+    }
+    return *instructions / *cycles;
+}
+
+PerfCounts PerfCounts::operator+(const PerfCounts& other) const {
+    auto result = PerfCounts{};
+    for (auto i = uz{ 0 }; i < numPerfEvents; ++i) {
+        if (values[i] && other.values[i]) {
+            result.values[i] = *values[i] + *other.values[i];
+        }
+    }
+    return result;
+}
+
+PerfCounts PerfCounts::operator/(const double divisor) const {
+    auto result = *this;
+    for (auto& value : result.values) {
+        if (value) {
+            *value /= divisor;
+        }
+    }
+    return result;
+}
+
+#if defined(__linux__)
+
+namespace {
+    [[nodiscard]] perf_event_attr eventAttributes(const PerfEvent event) {
+        auto attributes = perf_event_attr{};
+        attributes.size = sizeof(perf_event_attr);
+        attributes.type = PERF_TYPE_HARDWARE;
+        switch (event) {
+            case PerfEvent::Cycles:
+                attributes.config = PERF_COUNT_HW_CPU_CYCLES;
+                break;
+            case PerfEvent::Instructions:
+                attributes.config = PERF_COUNT_HW_INSTRUCTIONS;
+                break;
+            case PerfEvent::L1DataMisses:
+                attributes.type = PERF_TYPE_HW_CACHE;
+                attributes.config = PERF_COUNT_HW_CACHE_L1D | (PERF_COUNT_HW_CACHE_OP_READ << 8) |
+                                    (PERF_COUNT_HW_CACHE_RESULT_MISS << 16);
+                break;
+            case PerfEvent::LastLevelCacheMisses:
+                attributes.config = PERF_COUNT_HW_CACHE_MISSES;
+                break;
+            case PerfEvent::BranchMisses:
+                attributes.config = PERF_COUNT_HW_BRANCH_MISSES;
+                break;
+        }
+        attributes.disabled = 1;
+        attributes.exclude_kernel = 1;
+        attributes.exclude_hv = 1;
+        attributes.read_format = PERF_FORMAT_GROUP | PERF_FORMAT_ID | PERF_FORMAT_TOTAL_TIME_ENABLED |
+                                 PERF_FORMAT_TOTAL_TIME_RUNNING;
+        return attributes;
+    }
+
+    [[nodiscard]] int openEvent(perf_event_attr& attributes, const int groupLeader) {
+        // the calling thread on any CPU
+        return static_cast<int>(syscall(SYS_perf_event_open, &attributes, 0, -1, groupLeader, 0));
+    }
+}// namespace
+
+PerfCounterGroup::PerfCounterGroup() {
+    mDescriptors.fill(-1);
+    for (auto i = uz{ 0 }; i < numPerfEvents; ++i) {
+        const auto event = static_cast<PerfEvent>(i);
+        auto attributes = eventAttributes(event);
+        // the first event that opens leads the group, the others are scheduled together with it
+        const auto descriptor = openEvent(attributes, mLeader);
+        if (descriptor < 0) {
+            if (mError.empty()) {
+                mError = std::string{ perfEventName(event) } + ": " + std::strerror(errno);
+            }
+            continue;
+        }
+        if (ioctl(descriptor, PERF_EVENT_IOC_ID, &mIds[i]) != 0) {
+            close(descriptor);
+            continue;
+        }
+        mDescriptors[i] = descriptor;
+        if (mLeader < 0) {
+            mLeader = descriptor;
+        }
+    }
+}
+
+PerfCounterGroup::~PerfCounterGroup() {
+    // the members before the leader
+    for (const auto descriptor : mDescriptors) {
+        if (descriptor >= 0 && descriptor != mLeader) {
+            close(descriptor);
+        }
+    }
+    if (mLeader >= 0) {
+        close(mLeader);
+    }
+}
+
+void PerfCounterGroup::start() {
+    if (mLeader < 0) {
+        return;
+    }
+    ioctl(mLeader, PERF_EVENT_IOC_RESET, PERF_IOC_FLAG_GROUP);
+    ioctl(mLeader, PERF_EVENT_IOC_ENABLE, PERF_IOC_FLAG_GROUP);
+}
+
+PerfCounts PerfCounterGroup::stop() {
+    auto counts = PerfCounts{};
+    if (mLeader < 0) {
+        return counts;
+    }
+    ioctl(mLeader, PERF_EVENT_IOC_DISABLE, PERF_IOC_FLAG_GROUP);
+    // number of events, time enabled, time running and a value and id per event
+    auto buffer = std::array<u64, 3 + 2 * numPerfEvents>{};
+    const auto size = read(mLeader, buffer.data(), sizeof(buffer));
+    if (size < static_cast<ssize_t>(3 * sizeof(u64))) {
+        return counts;
+    }
+    const auto numEvents = std::min(static_cast<uz>(buffer[0]), numPerfEvents);
+    const auto enabled = static_cast<double>(buffer[1]);
+    const auto running = static_cast<double>(buffer[2]);
+    if (running == 0.0) {
+        // never scheduled, e.g. because the group does not fit on the PMU
+        return counts;
+    }
+    for (auto i = uz{ 0 }; i < numEvents; ++i) {
+        const auto value = static_cast<double>(buffer[3 + 2 * i]);
+        const auto id = buffer[4 + 2 * i];
+        for (auto event = uz{ 0 }; event < numPerfEvents; ++event) {
+            if (mDescriptors[event] >= 0 && mIds[event] == id) {
+                counts.values[event] = value * enabled / running;
+            }
+        }
+    }
+    return counts;
+}
+
+#else
+
+PerfCounterGroup::PerfCounterGroup() : mError{ "performance counters are only supported on Linux" } {
+    mDescriptors.fill(-1);
+}
+
+PerfCounterGroup::~PerfCounterGroup() = default;
+
+void PerfCounterGroup::start() { }
+
+PerfCounts PerfCounterGroup::stop() {
+    return PerfCounts{};
+}
+
+#endif
+
+bool PerfCounterGroup::available() const {
+    return mLeader >= 0;
+}
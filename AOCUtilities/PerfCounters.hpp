@@ -0,0 +1,77 @@
+#pragma once
+
+#include "AOCUtilities.hpp"
+#include <array>
+#include <optional>
+#include <string>
+#include <string_view>
+
+/* Hardware performance counters of the calling thread, read through perf_event_open on Linux. The events are
+ * opened as one group, so the kernel schedules them together and their ratios (instructions per cycle, misses
+ * per instruction) stay meaningful even when it has to multiplex them; the counts are scaled up by the share of
+ * the time the group was actually running.
+ *
+ * Only user space is counted (which perf_event_paranoid 2, the usual default, allows for the own process), and
+ * only the calling thread: the work of the thread pool does not show up, run with a single thread for the whole
+ * picture. Containers and virtual machines often have no counters at all, every event that cannot be opened is
+ * simply missing from the counts and available() tells whether any event could be opened.
+ *
+ *     auto counters = PerfCounterGroup{};
+ *     counters.start();
+ *     solve();
+ *     const auto counts = counters.stop();
+ */
+
+enum class PerfEvent {
+    Cycles,
+    Instructions,
+    L1DataMisses,
+    LastLevelCacheMisses,
+    BranchMisses,
+};
+
+constexpr auto numPerfEvents = uz{ 5 };
+
+[[nodiscard]] std::string_view perfEventName(PerfEvent event);
+
+struct PerfCounts {
+    std::array<std::optional<double>, numPerfEvents> values;
+
+    [[nodiscard]] std::optional<double> operator[](const PerfEvent event) const {
+        return values[static_cast<uz>(event)];
+    }
+
+    // instructions per cycle
+    [[nodiscard]] std::optional<double> ipc() const;
+
+    // the sum of two measurements, an event is only kept if both have it
+    [[nodiscard]] PerfCounts operator+(const PerfCounts& other) const;
+    [[nodiscard]] PerfCounts operator/(double divisor) const;
+};
+
+class PerfCounterGroup {
+public:
+    PerfCounterGroup();
+    PerfCounterGroup(const PerfCounterGroup&) = delete;
+    PerfCounterGroup& operator=(const PerfCounterGroup&) = delete;
+    ~PerfCounterGroup();
+
+    // whether at least one event could be opened
+    [[nodiscard]] bool available() const;
+
+    // why the first event that failed could not be opened, empty if all of them could
+    [[nodiscard]] const std::string& error() const {
+        return mError;
+    }
+
+    // resets and enables the counters
+    void start();
+    // disables the counters and returns what they counted since start()
+    [[nodiscard]] PerfCounts stop();
+
+private:
+    std::array<int, numPerfEvents> mDescriptors;// -1 for the events that could not be opened
+    std::array<u64, numPerfEvents> mIds{};
+    int mLeader{ -1 };
+    std::string mError;
+};
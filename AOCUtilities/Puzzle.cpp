@@ -0,0 +1,39 @@
+#include "Puzzle.hpp"
+#include <algorithm>
+
+std::filesystem::path Puzzle::inputPath(const std::filesystem::path& root) const {
+    return root / ((mDay < 10 ? "AdventOfCode0" : "AdventOfCode") + std::to_string(mDay)) / mInputFile;
+}
+
+namespace {
+    // function-local to not depend on the initialization order of the registrations
+    [[nodiscard]] std::vector<std::unique_ptr<Puzzle>>& puzzleRegistry() {
+        static auto registry = std::vector<std::unique_ptr<Puzzle>>{};
+        return registry;
+    }
+}// namespace
+
+std::vector<const Puzzle*> registeredPuzzles() {
+    auto result = std::vector<const Puzzle*>{};
+    for (const auto& puzzle : puzzleRegistry()) {
+        result.push_back(puzzle.get());
+    }
+    std::sort(result.begin(), result.end(), [](const auto lhs, const auto rhs) { return lhs->day() < rhs->day(); });
+    return result;
+}
+
+const Puzzle* findPuzzle(const u32 day) {
+    for (const auto& puzzle : puzzleRegistry()) {
+        if (puzzle->day() == day) {
+            return puzzle.get();
+        }
+    }
+    return nullptr;
+}
+
+void registerPuzzle(std::unique_ptr<Puzzle> puzzle) {
+    if (findPuzzle(puzzle->day()) != nullptr) {
+        throw std::runtime_error{ "Day " + std::to_string(puzzle->day()) + " has been registered twice. " };
+    }
+    puzzleRegistry().push_back(std::move(puzzle));
+}
@@ -0,0 +1,166 @@
+#pragma once
+
+#include "AOCUtilities.hpp"
+#include "ParseCache.hpp"
+#include <concepts>
+#include <filesystem>
+#include <memory>
+#include <optional>
+#include <sstream>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <typeinfo>
+#include <utility>
+#include <vector>
+
+/* Type-erased parse, part 1 and part 2 phases of one day. Every day registers itself through a
+ * PuzzleRegistration, so tools like the benchmark harness can run the phases separately without
+ * knowing the types involved. The parsed input may reference the input text, which therefore has
+ * to outlive it. */
+class Puzzle {
+public:
+    Puzzle(const u32 day, std::string inputFile) : mDay{ day }, mInputFile{ std::move(inputFile) } { }
+    virtual ~Puzzle() = default;
+
+    [[nodiscard]] u32 day() const {
+        return mDay;
+    }
+
+    // file name of the puzzle input, relative to the directory of the day
+    [[nodiscard]] const std::string& inputFile() const {
+        return mInputFile;
+    }
+
+    // the input file in the AdventOfCodeNN directory of the day below the given root directory
+    [[nodiscard]] std::filesystem::path inputPath(const std::filesystem::path& root) const;
+
+    [[nodiscard]] virtual std::shared_ptr<const void> parse(std::string_view input) const = 0;
+    // like parse(), but through the binary sidecar of the input file if the day has a ParseCacheFormat
+    [[nodiscard]] virtual std::shared_ptr<const void> parseCached(const std::filesystem::path& inputPath,
+                                                                  std::string_view input) const = 0;
+    [[nodiscard]] virtual bool hasParseCache() const = 0;
+    [[nodiscard]] virtual std::string part1(const void* parsed) const = 0;
+    [[nodiscard]] virtual std::string part2(const void* parsed) const = 0;
+    [[nodiscard]] virtual bool hasPart2() const = 0;
+    // the type of the parsed input behind the pointers above
+    [[nodiscard]] virtual const std::type_info& parsedType() const = 0;
+
+private:
+    u32 mDay;
+    std::string mInputFile;
+};
+
+// all registered puzzles ordered by day
+[[nodiscard]] std::vector<const Puzzle*> registeredPuzzles();
+
+[[nodiscard]] const Puzzle* findPuzzle(u32 day);
+
+void registerPuzzle(std::unique_ptr<Puzzle> puzzle);
+
+// answers are strings or anything that can be written to an std::ostream
+template<typename T>
+concept PuzzleAnswer = std::convertible_to<T, std::string> || requires(std::ostream& stream, const T& answer) {
+    stream << answer;
+};
+
+template<typename Parse>
+using ParsedInput = std::invoke_result_t<Parse, std::string_view>;
+
+/* The phases of a day: parse(input) turns the text into the parsed input, which part1(parsed) and part2(parsed)
+ * only read, so a single parse serves both parts. Part 2 is nullptr for days that only solve the first part. */
+template<typename Parse, typename Part1, typename Part2>
+concept Solver = std::invocable<const Parse&, std::string_view> &&
+                 std::invocable<const Part1&, const ParsedInput<Parse>&> &&
+                 PuzzleAnswer<std::invoke_result_t<const Part1&, const ParsedInput<Parse>&>> &&
+                 (std::is_null_pointer_v<Part2> || (std::invocable<const Part2&, const ParsedInput<Parse>&> &&
+                                                    PuzzleAnswer<std::invoke_result_t<const Part2&,
+                                                                                      const ParsedInput<Parse>&>>));
+
+template<PuzzleAnswer Answer>
+[[nodiscard]] std::string answerToString(const Answer& answer) {
+    if constexpr (std::is_convertible_v<Answer, std::string>) {
+        return std::string{ answer };
+    } else {
+        auto stream = std::ostringstream{};
+        stream << answer;
+        return std::move(stream).str();
+    }
+}
+
+template<typename Parse, typename Part1, typename Part2>
+    requires Solver<Parse, Part1, Part2>
+class PuzzleAdapter : public Puzzle {
+public:
+    using Parsed = ParsedInput<Parse>;
+
+    PuzzleAdapter(const u32 day, std::string inputFile, Parse parse, Part1 part1, Part2 part2,
+                  std::optional<ParseCacheFormat<Parsed>> cacheFormat = std::nullopt)
+        : Puzzle{ day, std::move(inputFile) },
+          mParse{ parse },
+          mPart1{ part1 },
+          mPart2{ part2 },
+          mCacheFormat{ cacheFormat } { }
+
+    [[nodiscard]] std::shared_ptr<const void> parse(const std::string_view input) const override {
+        return std::make_shared<const Parsed>(mParse(input));
+    }
+
+    [[nodiscard]] std::shared_ptr<const void> parseCached(const std::filesystem::path& inputPath,
+                                                          const std::string_view input) const override {
+        if (!mCacheFormat) {
+            return parse(input);
+        }
+        return std::make_shared<const Parsed>(parseWithCache(inputPath, input, mParse, *mCacheFormat));
+    }
+
+    [[nodiscard]] bool hasParseCache() const override {
+        return mCacheFormat.has_value();
+    }
+
+    [[nodiscard]] std::string part1(const void* const parsed) const override {
+        return answerToString(mPart1(*static_cast<const Parsed*>(parsed)));
+    }
+
+    [[nodiscard]] std::string part2(const void* const parsed) const override {
+        if constexpr (std::is_null_pointer_v<Part2>) {
+            return {};
+        } else {
+            return answerToString(mPart2(*static_cast<const Parsed*>(parsed)));
+        }
+    }
+
+    [[nodiscard]] bool hasPart2() const override {
+        return !std::is_null_pointer_v<Part2>;
+    }
+
+    [[nodiscard]] const std::type_info& parsedType() const override {
+        return typeid(Parsed);
+    }
+
+private:
+    Parse mParse;
+    Part1 mPart1;
+    Part2 mPart2;
+    std::optional<ParseCacheFormat<Parsed>> mCacheFormat;
+};
+
+/* Registers a day on construction, meant to be used for a namespace scope constant next to the
+ * solution. Pass nullptr as part 2 if a day only solves the first part. */
+struct PuzzleRegistration {
+    template<typename Parse, typename Part1, typename Part2>
+        requires Solver<Parse, Part1, Part2>
+    PuzzleRegistration(const u32 day, std::string inputFile, Parse parse, Part1 part1, Part2 part2) {
+        registerPuzzle(std::make_unique<PuzzleAdapter<Parse, Part1, Part2>>(day, std::move(inputFile), parse, part1,
+                                                                             part2));
+    }
+
+    // for days whose parsed input can be cached in a binary sidecar of the input file
+    template<typename Parse, typename Part1, typename Part2, typename Parsed>
+        requires Solver<Parse, Part1, Part2>
+    PuzzleRegistration(const u32 day, std::string inputFile, Parse parse, Part1 part1, Part2 part2,
+                       const ParseCacheFormat<Parsed>& cacheFormat) {
+        registerPuzzle(std::make_unique<PuzzleAdapter<Parse, Part1, Part2>>(day, std::move(inputFile), parse, part1,
+                                                                             part2, cacheFormat));
+    }
+};
@@ -0,0 +1,162 @@
+#include "PuzzleMain.hpp"
+#include "ThreadPool.hpp"
+#include <algorithm>
+#include <chrono>
+#include <filesystem>
+#include <iomanip>
+#include <iostream>
+#include <memory>
+#include <span>
+#include <string>
+#include <vector>
+
+namespace {
+    using Clock = std::chrono::steady_clock;
+
+    struct Options {
+        std::filesystem::path input;// the input file of the day if empty
+        PartSelection parts;
+        uz repetitions{ 1 };
+        uz threads{ 0 };// the default size of the thread pool if 0
+        bool parseCache{ true };
+        bool verbose{ false };
+    };
+
+    [[nodiscard]] Options parseOptions(const int argc, char** const argv) {
+        auto options = Options{};
+        for (auto i = 1; i < argc; ++i) {
+            const auto argument = std::string_view{ argv[i] };
+            if (argument == "--help" || argument == "-h") {
+                std::cout << puzzleMainUsage;
+                std::exit(0);
+            }
+            if (argument == "--no-parse-cache") {
+                options.parseCache = false;
+                continue;
+            }
+            if (argument == "--verbose") {
+                options.verbose = true;
+                continue;
+            }
+            if (i + 1 >= argc) {
+                throw std::runtime_error{ "Missing value for option " + std::string{ argument } + ". " };
+            }
+            const auto value = std::string_view{ argv[++i] };
+            if (argument == "--input") {
+                options.input = value;
+            } else if (argument == "--part") {
+                options.parts = PartSelection::fromString(value);
+            } else if (argument == "--repeat") {
+                options.repetitions = std::max(parseInteger<uz>(value), uz{ 1 });
+            } else if (argument == "--threads") {
+                options.threads = parseInteger<uz>(value);
+            } else {
+                throw std::runtime_error{ "Unknown option " + std::string{ argument } + ". " };
+            }
+        }
+        return options;
+    }
+
+    // the fastest of the repetitions of a phase
+    struct PhaseTime {
+        std::string_view name;
+        Clock::duration fastest{ Clock::duration::max() };
+
+        template<typename Phase>
+        auto measure(Phase&& phase) {
+            const auto start = Clock::now();
+            auto result = phase();
+            fastest = std::min(fastest, Clock::now() - start);
+            return result;
+        }
+    };
+
+    void printTimes(const u32 day, const std::span<const PhaseTime> phases) {
+        std::cout << "Day " << std::setw(2) << std::setfill('0') << day << std::setfill(' ') << std::fixed
+                  << std::setprecision(3);
+        for (const auto& phase : phases) {
+            std::cout << "  " << phase.name << " " << std::chrono::duration<double, std::milli>(phase.fastest).count()
+                      << " ms";
+        }
+        std::cout << "\n";
+    }
+}// namespace
+
+PartSelection PartSelection::fromString(const std::string_view value) {
+    if (value == "1") {
+        return PartSelection{ true, false };
+    }
+    if (value == "2") {
+        return PartSelection{ false, true };
+    }
+    throw std::runtime_error{ "Expected 1 or 2 for --part. " };
+}
+
+void printAnswer(std::ostream& ostream, const std::string_view name, const std::string_view answer) {
+    ostream << "  " << name << ":" << (answer.find('\n') != std::string_view::npos ? "\n" : " ") << answer;
+    if (!answer.ends_with('\n')) {
+        ostream << '\n';
+    }
+}
+
+int detail::runPuzzleMain(const u32 day,
+                          const int argc,
+                          char** const argv,
+                          const std::function<void(const void*)>& show) {
+    try {
+        const auto options = parseOptions(argc, argv);
+        const auto puzzle = findPuzzle(day);
+        if (puzzle == nullptr) {
+            throw std::runtime_error{ "Day " + std::to_string(day) + " is not registered. " };
+        }
+        if (options.parts.part2 && !options.parts.part1 && !puzzle->hasPart2()) {
+            throw std::runtime_error{ "Day " + std::to_string(day) + " does not solve part 2. " };
+        }
+        if (options.threads != 0) {
+            resizeThreadPool(options.threads);
+        }
+        const auto path = options.input.empty() ? std::filesystem::path{ puzzle->inputFile() } : options.input;
+        const auto input = MappedInput{ path.string() };
+
+        auto phases = std::vector<PhaseTime>{ { "parse" } };
+        const auto solvePart1 = options.parts.part1;
+        const auto solvePart2 = options.parts.part2 && puzzle->hasPart2();
+        if (solvePart1) {
+            phases.push_back({ "part 1" });
+        }
+        if (solvePart2) {
+            phases.push_back({ "part 2" });
+        }
+        auto parsed = std::shared_ptr<const void>{};
+        auto answer1 = std::string{};
+        auto answer2 = std::string{};
+        for (auto i = uz{ 0 }; i < options.repetitions; ++i) {
+            auto phase = phases.begin();
+            parsed = phase++->measure([&] {
+                return options.parseCache ? puzzle->parseCached(path, input.contents())
+                                          : puzzle->parse(input.contents());
+            });
+            if (solvePart1) {
+                answer1 = phase++->measure([&] { return puzzle->part1(parsed.get()); });
+            }
+            if (solvePart2) {
+                answer2 = phase++->measure([&] { return puzzle->part2(parsed.get()); });
+            }
+        }
+
+        if (options.verbose && show) {
+            show(parsed.get());
+        }
+        printTimes(day, phases);
+        if (solvePart1) {
+            printAnswer(std::cout, "part 1", answer1);
+        }
+        if (solvePart2) {
+            printAnswer(std::cout, "part 2", answer2);
+        }
+    } catch (const std::exception& exception) {
+        std::cerr << exception.what() << "\n" << puzzleMainUsage;
+        return 1;
+    }
+    return 0;
+}
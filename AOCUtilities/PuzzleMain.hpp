@@ -0,0 +1,61 @@
+#pragma once
+
+#include "AOCUtilities.hpp"
+#include "Puzzle.hpp"
+#include <functional>
+#include <ostream>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <typeinfo>
+
+/* The command line shared by the AdventOfCodeNN executables, whose main() only names the registered day:
+ *
+ *     int main(const int argc, char** const argv) {
+ *         return runPuzzleMain(2, argc, argv);
+ *     }
+ *
+ * The input is parsed once and the selected parts are solved from it, every phase is timed on its own. A day
+ * with more to show than its answers (renderings, intermediate results) passes a function of its parsed input,
+ * which only runs with --verbose, so the timed runs stay the same for every day. */
+
+constexpr auto puzzleMainUsage = std::string_view{
+    "Usage: AdventOfCodeNN [options]\n"
+    "  --input FILE          puzzle input (default: the input file of the day in the working directory)\n"
+    "  --part 1|2            only solve one part (default: both)\n"
+    "  --repeat N            run every phase N times and report the fastest run (default: 1)\n"
+    "  --threads N           size of the thread pool (default: $AOC_THREADS or all hardware threads)\n"
+    "  --no-parse-cache      always parse the text, instead of loading and writing the .bin sidecar\n"
+    "  --verbose             print what the day shows besides its answers\n"
+};
+
+// which parts to solve, from the value of --part
+struct PartSelection {
+    bool part1{ true };
+    bool part2{ true };
+
+    [[nodiscard]] static PartSelection fromString(std::string_view value);
+};
+
+// multi-line answers (like rendered images) start on a line of their own
+void printAnswer(std::ostream& ostream, std::string_view name, std::string_view answer);
+
+namespace detail {
+    int runPuzzleMain(u32 day, int argc, char** argv, const std::function<void(const void*)>& show);
+}// namespace detail
+
+// returns the exit code of the program
+inline int runPuzzleMain(const u32 day, const int argc, char** const argv) {
+    return detail::runPuzzleMain(day, argc, argv, {});
+}
+
+// show(parsed) prints the extra output of --verbose, Parsed has to be the parsed input of the day
+template<typename Parsed, typename Show>
+int runPuzzleMain(const u32 day, const int argc, char** const argv, Show show) {
+    return detail::runPuzzleMain(day, argc, argv, [&](const void* const parsed) {
+        if (findPuzzle(day)->parsedType() != typeid(Parsed)) {
+            throw std::runtime_error{ "The parsed input of day " + std::to_string(day) + " has another type. " };
+        }
+        show(*static_cast<const Parsed*>(parsed));
+    });
+}
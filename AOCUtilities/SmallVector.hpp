@@ -0,0 +1,261 @@
+#pragma once
+
+#include "AOCUtilities.hpp"
+#include <algorithm>
+#include <cassert>
+#include <cstddef>
+#include <initializer_list>
+#include <memory>
+#include <new>
+#include <stdexcept>
+#include <utility>
+
+/* A vector whose first N elements live inside of the object, for the temporaries of hot loops that are
+ * almost always small: as long as it holds at most N elements, it never touches the allocator. Beyond that it
+ * moves to the heap like std::vector (and stays there until it is destroyed, clear() keeps the capacity).
+ * The element type has to be complete where the SmallVector is declared, so recursive types still need
+ * std::vector. Iterators are pointers, so a SmallVector converts to std::span. */
+template<typename T, uz N>
+class SmallVector {
+    static_assert(N > 0, "A SmallVector without inline storage is a std::vector. ");
+
+public:
+    using value_type = T;
+    using size_type = uz;
+    using iterator = T*;
+    using const_iterator = const T*;
+
+    SmallVector() = default;
+
+    explicit SmallVector(const uz count) {
+        resize(count);
+    }
+
+    SmallVector(const uz count, const T& value) {
+        reserve(count);
+        std::uninitialized_fill_n(mData, count, value);
+        mSize = count;
+    }
+
+    SmallVector(const std::initializer_list<T> values) {
+        reserve(values.size());
+        std::uninitialized_copy(values.begin(), values.end(), mData);
+        mSize = values.size();
+    }
+
+    SmallVector(const SmallVector& other) {
+        reserve(other.mSize);
+        std::uninitialized_copy(other.begin(), other.end(), mData);
+        mSize = other.mSize;
+    }
+
+    SmallVector(SmallVector&& other) noexcept(std::is_nothrow_move_constructible_v<T>) {
+        takeFrom(other);
+    }
+
+    SmallVector& operator=(const SmallVector& other) {
+        if (this != &other) {
+            clear();
+            reserve(other.mSize);
+            std::uninitialized_copy(other.begin(), other.end(), mData);
+            mSize = other.mSize;
+        }
+        return *this;
+    }
+
+    SmallVector& operator=(SmallVector&& other) noexcept(std::is_nothrow_move_constructible_v<T>) {
+        if (this != &other) {
+            clear();
+            releaseHeap();
+            takeFrom(other);
+        }
+        return *this;
+    }
+
+    ~SmallVector() {
+        clear();
+        releaseHeap();
+    }
+
+    [[nodiscard]] static constexpr uz inlineCapacity() {
+        return N;
+    }
+
+    // whether the elements are still stored inside of the object
+    [[nodiscard]] bool isInline() const {
+        return mData == inlineData();
+    }
+
+    [[nodiscard]] uz size() const {
+        return mSize;
+    }
+
+    [[nodiscard]] uz capacity() const {
+        return mCapacity;
+    }
+
+    [[nodiscard]] bool empty() const {
+        return mSize == 0;
+    }
+
+    [[nodiscard]] T* data() {
+        return mData;
+    }
+
+    [[nodiscard]] const T* data() const {
+        return mData;
+    }
+
+    [[nodiscard]] T* begin() {
+        return mData;
+    }
+
+    [[nodiscard]] const T* begin() const {
+        return mData;
+    }
+
+    [[nodiscard]] T* end() {
+        return mData + mSize;
+    }
+
+    [[nodiscard]] const T* end() const {
+        return mData + mSize;
+    }
+
+    [[nodiscard]] T& operator[](const uz index) {
+        assert(index < mSize);
+        return mData[index];
+    }
+
+    [[nodiscard]] const T& operator[](const uz index) const {
+        assert(index < mSize);
+        return mData[index];
+    }
+
+    [[nodiscard]] T& at(const uz index) {
+        if (index >= mSize) {
+            throw std::out_of_range{ "SmallVector index out of range. " };
+        }
+        return mData[index];
+    }
+
+    [[nodiscard]] const T& at(const uz index) const {
+        if (index >= mSize) {
+            throw std::out_of_range{ "SmallVector index out of range. " };
+        }
+        return mData[index];
+    }
+
+    [[nodiscard]] T& front() {
+        assert(mSize > 0);
+        return mData[0];
+    }
+
+    [[nodiscard]] const T& front() const {
+        assert(mSize > 0);
+        return mData[0];
+    }
+
+    [[nodiscard]] T& back() {
+        assert(mSize > 0);
+        return mData[mSize - 1];
+    }
+
+    [[nodiscard]] const T& back() const {
+        assert(mSize > 0);
+        return mData[mSize - 1];
+    }
+
+    void push_back(const T& value) {
+        emplace_back(value);
+    }
+
+    void push_back(T&& value) {
+        emplace_back(std::move(value));
+    }
+
+    // the arguments may refer to elements of the vector itself
+    template<typename... Args>
+    T& emplace_back(Args&&... args) {
+        if (mSize < mCapacity) {
+            return *std::construct_at(mData + mSize++, std::forward<Args>(args)...);
+        }
+        // the new element is constructed before the old ones move, in case it is made from one of them
+        const auto newCapacity = std::max(2 * mCapacity, mSize + 1);
+        auto* const newData = std::allocator<T>{}.allocate(newCapacity);
+        std::construct_at(newData + mSize, std::forward<Args>(args)...);
+        moveTo(newData, newCapacity);
+        return mData[mSize++];
+    }
+
+    void pop_back() {
+        assert(mSize > 0);
+        std::destroy_at(mData + --mSize);
+    }
+
+    void clear() {
+        std::destroy_n(mData, mSize);
+        mSize = 0;
+    }
+
+    void reserve(const uz capacity) {
+        if (capacity > mCapacity) {
+            moveTo(std::allocator<T>{}.allocate(capacity), capacity);
+        }
+    }
+
+    // new elements are value-initialized
+    void resize(const uz size) {
+        if (size < mSize) {
+            std::destroy(mData + size, mData + mSize);
+        } else {
+            reserve(size);
+            std::uninitialized_value_construct(mData + mSize, mData + size);
+        }
+        mSize = size;
+    }
+
+private:
+    [[nodiscard]] T* inlineData() {
+        return std::launder(reinterpret_cast<T*>(mInline));
+    }
+
+    [[nodiscard]] const T* inlineData() const {
+        return std::launder(reinterpret_cast<const T*>(mInline));
+    }
+
+    // moves the elements into the new heap block and releases the old one
+    void moveTo(T* const newData, const uz newCapacity) {
+        std::uninitialized_move_n(mData, mSize, newData);
+        std::destroy_n(mData, mSize);
+        releaseHeap();
+        mData = newData;
+        mCapacity = newCapacity;
+    }
+
+    void releaseHeap() {
+        if (!isInline()) {
+            std::allocator<T>{}.deallocate(mData, mCapacity);
+            mData = inlineData();
+            mCapacity = N;
+        }
+    }
+
+    // expects this to be empty and inline, leaves other empty
+    void takeFrom(SmallVector& other) {
+        if (other.isInline()) {
+            std::uninitialized_move_n(other.mData, other.mSize, mData);
+            mSize = other.mSize;
+            other.clear();
+            return;
+        }
+        mData = std::exchange(other.mData, other.inlineData());
+        mSize = std::exchange(other.mSize, 0);
+        mCapacity = std::exchange(other.mCapacity, N);
+    }
+
+    alignas(T) std::byte mInline[N * sizeof(T)];
+    T* mData{ inlineData() };
+    uz mSize{ 0 };
+    uz mCapacity{ N };
+};
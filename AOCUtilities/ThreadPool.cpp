@@ -0,0 +1,129 @@
+#include "ThreadPool.hpp"
+#include <charconv>
+#include <cstdlib>
+#include <stdexcept>
+#include <string_view>
+
+namespace {
+    // set on the workers, so tasks they submit go to their own queue
+    thread_local const ThreadPool* currentPool = nullptr;
+    thread_local uz currentQueue = 0;
+
+    std::mutex processPoolMutex;
+    std::unique_ptr<ThreadPool> processPool;
+}// namespace
+
+ThreadPool::ThreadPool(const uz numThreads) {
+    const auto numWorkers = std::max(numThreads, uz{ 1 }) - 1;
+    for (auto i = uz{ 0 }; i <= numWorkers; ++i) {
+        mQueues.push_back(std::make_unique<Queue>());
+    }
+    mWorkers.reserve(numWorkers);
+    for (auto i = uz{ 0 }; i < numWorkers; ++i) {
+        mWorkers.emplace_back([this, i]() { runWorker(i); });
+    }
+}
+
+ThreadPool::~ThreadPool() {
+    {
+        const auto lock = std::scoped_lock{ mSleepMutex };
+        mStopping = true;
+    }
+    mWakeUp.notify_all();
+    // the workers finish the queued tasks before they stop, the jthreads join them
+    mWorkers.clear();
+}
+
+void ThreadPool::submit(Task task) {
+    const auto queue = (currentPool == this) ? currentQueue : mQueues.size() - 1;
+    {
+        // counted before the task is visible, so a worker taking it never sees the count below zero
+        const auto lock = std::scoped_lock{ mSleepMutex };
+        mNumQueued.fetch_add(1, std::memory_order_relaxed);
+    }
+    {
+        const auto lock = std::scoped_lock{ mQueues[queue]->mutex };
+        mQueues[queue]->tasks.push_back(std::move(task));
+    }
+    mWakeUp.notify_one();
+}
+
+bool ThreadPool::runPendingTask() {
+    auto task = takeTask(currentPool == this ? currentQueue : mQueues.size() - 1);
+    if (!task) {
+        return false;
+    }
+    (*task)();
+    return true;
+}
+
+std::optional<ThreadPool::Task> ThreadPool::takeTask(const uz ownQueue) {
+    if (mNumQueued.load(std::memory_order_relaxed) == 0) {
+        return std::nullopt;
+    }
+    const auto numQueues = mQueues.size();
+    // the newest task of the own queue, then the oldest one of the others, starting with the shared queue
+    for (auto offset = uz{ 0 }; offset < numQueues; ++offset) {
+        const auto index = (ownQueue + numQueues - offset) % numQueues;
+        auto& queue = *mQueues[index];
+        const auto lock = std::scoped_lock{ queue.mutex };
+        if (queue.tasks.empty()) {
+            continue;
+        }
+        auto task = std::optional<Task>{};
+        if (offset == 0) {
+            task = std::move(queue.tasks.back());
+            queue.tasks.pop_back();
+        } else {
+            task = std::move(queue.tasks.front());
+            queue.tasks.pop_front();
+        }
+        mNumQueued.fetch_sub(1, std::memory_order_relaxed);
+        return task;
+    }
+    return std::nullopt;
+}
+
+void ThreadPool::runWorker(const uz index) {
+    currentPool = this;
+    currentQueue = index;
+    while (true) {
+        if (auto task = takeTask(index)) {
+            (*task)();
+            continue;
+        }
+        auto lock = std::unique_lock{ mSleepMutex };
+        mWakeUp.wait(lock, [this]() { return mStopping || mNumQueued.load(std::memory_order_relaxed) > 0; });
+        if (mStopping && mNumQueued.load(std::memory_order_relaxed) == 0) {
+            return;
+        }
+    }
+}
+
+uz defaultNumThreads() {
+    if (const auto* const value = std::getenv("AOC_THREADS"); value != nullptr && *value != '\0') {
+        const auto string = std::string_view{ value };
+        auto numThreads = uz{ 0 };
+        const auto [end, error] = std::from_chars(string.data(), string.data() + string.size(), numThreads);
+        if (error != std::errc{} || end != string.data() + string.size() || numThreads == 0) {
+            throw std::runtime_error{ "AOC_THREADS is not a positive number. " };
+        }
+        return numThreads;
+    }
+    return std::max(uz{ 1 }, static_cast<uz>(std::thread::hardware_concurrency()));
+}
+
+ThreadPool& threadPool() {
+    const auto lock = std::scoped_lock{ processPoolMutex };
+    if (!processPool) {
+        processPool = std::make_unique<ThreadPool>(defaultNumThreads());
+    }
+    return *processPool;
+}
+
+void resizeThreadPool(const uz numThreads) {
+    const auto lock = std::scoped_lock{ processPoolMutex };
+    // the workers of the previous pool are joined before the new ones start
+    processPool.reset();
+    processPool = std::make_unique<ThreadPool>(numThreads);
+}
@@ -0,0 +1,195 @@
+#pragma once
+
+#include "AOCUtilities.hpp"
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <thread>
+#include <utility>
+#include <vector>
+
+/* Work-stealing thread pool shared by all puzzles. Every worker has its own deque: tasks submitted by a worker
+ * go to the back of its deque and are taken from there again (the data they touch is most likely still in the
+ * cache), idle workers steal from the front of the other deques. Tasks submitted by other threads go to a
+ * shared deque.
+ *
+ * The thread waiting for a TaskGroup runs queued tasks itself instead of blocking, so the pool has one worker
+ * less than numThreads() and nested parallelism cannot deadlock. With a single thread there are no workers at
+ * all and every task runs on the waiting thread, in the order it was submitted.
+ *
+ *     const auto total = parallelReduce(uz{ 0 }, lines.size(), u64{ 0 },
+ *                                       [&](const uz i) { return solveLine(lines[i]); }, std::plus<>{});
+ */
+class ThreadPool {
+public:
+    using Task = std::function<void()>;
+
+    // numThreads includes the thread that waits for the tasks, 0 is the same as 1
+    explicit ThreadPool(uz numThreads);
+    ~ThreadPool();
+
+    ThreadPool(const ThreadPool&) = delete;
+    ThreadPool& operator=(const ThreadPool&) = delete;
+
+    [[nodiscard]] uz numThreads() const {
+        return mWorkers.size() + 1;
+    }
+
+    void submit(Task task);
+
+    // runs one queued task on the calling thread, false if there was none
+    bool runPendingTask();
+
+private:
+    struct Queue {
+        std::mutex mutex;
+        std::deque<Task> tasks;
+    };
+
+    [[nodiscard]] std::optional<Task> takeTask(uz ownQueue);
+    void runWorker(uz index);
+
+    // one queue per worker and the shared queue last
+    std::vector<std::unique_ptr<Queue>> mQueues;
+    std::vector<std::jthread> mWorkers;
+    std::atomic<uz> mNumQueued{ 0 };
+    std::mutex mSleepMutex;
+    std::condition_variable mWakeUp;
+    bool mStopping{ false };
+};
+
+// $AOC_THREADS if it is set, otherwise the number of hardware threads
+[[nodiscard]] uz defaultNumThreads();
+
+// the pool of the process with defaultNumThreads() threads, created on first use
+[[nodiscard]] ThreadPool& threadPool();
+
+/* Replaces the pool of the process by one with numThreads threads, e.g. to measure how a solution scales.
+ * No tasks may be running, references to the previous pool are invalid afterwards. */
+void resizeThreadPool(uz numThreads);
+
+/* Tasks that are waited for together. wait() runs queued tasks until all tasks of the group are finished and
+ * rethrows the first exception one of them threw. The destructor waits as well, but swallows exceptions. */
+class TaskGroup {
+public:
+    explicit TaskGroup(ThreadPool& pool = threadPool()) : mPool{ pool } { }
+
+    TaskGroup(const TaskGroup&) = delete;
+    TaskGroup& operator=(const TaskGroup&) = delete;
+
+    ~TaskGroup() {
+        waitForTasks();
+    }
+
+    template<typename Function>
+    void run(Function&& function) {
+        mNumPending.fetch_add(1, std::memory_order_relaxed);
+        mPool.submit([this, function = std::forward<Function>(function)]() mutable {
+            try {
+                function();
+            } catch (...) {
+                const auto lock = std::scoped_lock{ mExceptionMutex };
+                if (!mException) {
+                    mException = std::current_exception();
+                }
+            }
+            mNumPending.fetch_sub(1, std::memory_order_release);
+        });
+    }
+
+    void wait() {
+        waitForTasks();
+        if (mException) {
+            std::rethrow_exception(std::exchange(mException, nullptr));
+        }
+    }
+
+private:
+    void waitForTasks() {
+        while (mNumPending.load(std::memory_order_acquire) > 0) {
+            if (!mPool.runPendingTask()) {
+                std::this_thread::yield();
+            }
+        }
+    }
+
+    ThreadPool& mPool;
+    std::atomic<uz> mNumPending{ 0 };
+    std::mutex mExceptionMutex;
+    std::exception_ptr mException;
+};
+
+namespace detail {
+    // a few chunks per thread, so threads that finish early can steal the chunks of slower ones
+    constexpr auto chunksPerThread = uz{ 4 };
+
+    [[nodiscard]] inline uz numChunks(const uz size, const ThreadPool& pool) {
+        return std::min(size, pool.numThreads() == 1 ? uz{ 1 } : pool.numThreads() * chunksPerThread);
+    }
+
+    // calls function(chunk, begin, end) for numChunks contiguous chunks of [begin, end)
+    template<typename Function>
+    void forEachChunk(const uz begin, const uz end, const uz numChunks, Function&& function,
+                      ThreadPool& pool = threadPool()) {
+        const auto size = end - begin;
+        if (numChunks <= 1) {
+            function(uz{ 0 }, begin, end);
+            return;
+        }
+        auto group = TaskGroup{ pool };
+        for (auto chunk = uz{ 0 }; chunk < numChunks; ++chunk) {
+            const auto chunkBegin = begin + size * chunk / numChunks;
+            const auto chunkEnd = begin + size * (chunk + 1) / numChunks;
+            group.run([&function, chunk, chunkBegin, chunkEnd]() { function(chunk, chunkBegin, chunkEnd); });
+        }
+        group.wait();
+    }
+}// namespace detail
+
+// calls body(i) for every i in [begin, end), in no particular order and possibly on several threads at once
+template<typename Body>
+void parallelFor(const uz begin, const uz end, Body&& body, ThreadPool& pool = threadPool()) {
+    if (begin >= end) {
+        return;
+    }
+    detail::forEachChunk(begin, end, detail::numChunks(end - begin, pool),
+                         [&body](const uz, const uz chunkBegin, const uz chunkEnd) {
+                             for (auto i = chunkBegin; i < chunkEnd; ++i) {
+                                 body(i);
+                             }
+                         },
+                         pool);
+}
+
+/* Folds map(i) for every i in [begin, end) with combine, starting from identity. Every chunk is folded on its
+ * own and the chunk results are combined in order, so combine has to be associative but need not be
+ * commutative. */
+template<typename T, typename Map, typename Combine>
+[[nodiscard]] T parallelReduce(const uz begin, const uz end, const T& identity, Map&& map, Combine&& combine,
+                               ThreadPool& pool = threadPool()) {
+    if (begin >= end) {
+        return identity;
+    }
+    const auto numChunks = detail::numChunks(end - begin, pool);
+    auto chunkResults = std::vector<T>(numChunks, identity);
+    detail::forEachChunk(begin, end, numChunks,
+                         [&](const uz chunk, const uz chunkBegin, const uz chunkEnd) {
+                             auto result = identity;
+                             for (auto i = chunkBegin; i < chunkEnd; ++i) {
+                                 result = combine(std::move(result), map(i));
+                             }
+                             chunkResults[chunk] = std::move(result);
+                         },
+                         pool);
+    auto result = identity;
+    for (auto& chunkResult : chunkResults) {
+        result = combine(std::move(result), std::move(chunkResult));
+    }
+    return result;
+}
@@ -0,0 +1,95 @@
+#include "Trace.hpp"
+
+#if defined(AOC_ENABLE_TRACING)
+
+#include <cstdlib>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+namespace {
+    struct TraceEvent {
+        const char* name;
+        u64 start;
+        u64 end;
+    };
+
+    struct ThreadBuffer {
+        uz threadIndex;
+        std::vector<TraceEvent> events;
+    };
+
+    /* Owns the buffers of all threads, so zones of threads that have already finished are still written.
+     * Destroyed after main returns, which is when the trace file is written. */
+    class TraceRegistry {
+    public:
+        TraceRegistry() : mStart{ detail::traceTimestamp() } { }
+
+        ~TraceRegistry() {
+            const auto* const path = std::getenv("AOC_TRACE_FILE");
+            auto file = std::ofstream{ path != nullptr ? path : "trace.json" };
+            if (!file) {
+                std::cerr << "Unable to write the trace file. \n";
+                return;
+            }
+            write(file);
+        }
+
+        [[nodiscard]] ThreadBuffer& addThread() {
+            const auto lock = std::scoped_lock{ mMutex };
+            mBuffers.push_back(std::make_unique<ThreadBuffer>(ThreadBuffer{ mBuffers.size(), {} }));
+            mBuffers.back()->events.reserve(1024);
+            return *mBuffers.back();
+        }
+
+        // timestamps in microseconds relative to the start of the program, as the format expects
+        void write(std::ostream& stream) {
+            const auto lock = std::scoped_lock{ mMutex };
+            const auto toMicroseconds = [](const u64 nanoseconds) { return static_cast<double>(nanoseconds) / 1000.0; };
+            stream << "{\"displayTimeUnit\":\"ns\",\"traceEvents\":[";
+            auto first = true;
+            for (const auto& buffer : mBuffers) {
+                stream << (first ? "" : ",") << "\n{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":"
+                       << buffer->threadIndex << ",\"args\":{\"name\":\"thread " << buffer->threadIndex << "\"}}";
+                first = false;
+                for (const auto& event : buffer->events) {
+                    stream << ",\n{\"name\":\"";
+                    for (const auto* c = event.name; *c != '\0'; ++c) {
+                        stream << ((*c == '"' || *c == '\\') ? "\\" : "") << *c;
+                    }
+                    stream << "\",\"cat\":\"aoc\",\"ph\":\"X\",\"pid\":1,\"tid\":" << buffer->threadIndex
+                           << ",\"ts\":" << std::fixed << std::setprecision(3)
+                           << toMicroseconds(event.start - std::min(event.start, mStart))
+                           << ",\"dur\":" << toMicroseconds(event.end - event.start) << "}";
+                }
+            }
+            stream << "\n]}\n";
+        }
+
+    private:
+        u64 mStart;
+        std::mutex mMutex;
+        std::vector<std::unique_ptr<ThreadBuffer>> mBuffers;
+    };
+
+    [[nodiscard]] TraceRegistry& traceRegistry() {
+        static auto registry = TraceRegistry{};
+        return registry;
+    }
+}// namespace
+
+namespace detail {
+    void recordTraceZone(const char* const name, const u64 start, const u64 end) {
+        thread_local auto& buffer = traceRegistry().addThread();
+        buffer.events.push_back(TraceEvent{ name, start, end });
+    }
+}// namespace detail
+
+void writeTrace(std::ostream& stream) {
+    traceRegistry().write(stream);
+}
+
+#endif
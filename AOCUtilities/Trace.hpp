@@ -0,0 +1,57 @@
+#pragma once
+
+#include "AOCUtilities.hpp"
+#include <chrono>
+#include <ostream>
+
+/* Scoped zones for looking inside a run, written as Chrome trace JSON that chrome://tracing and
+ * https://ui.perfetto.dev load directly. Tracing is compiled in with the CMake option AOC_ENABLE_TRACING,
+ * otherwise AOC_TRACE_ZONE expands to nothing and costs nothing.
+ *
+ *     AOC_TRACE_ZONE("day13::applyFold");
+ *
+ * records the time from the statement to the end of the enclosing scope. The name has to be a string
+ * literal (or live as long as the program). Every thread appends to its own buffer, so zones never lock,
+ * and the buffers are written to $AOC_TRACE_FILE (default trace.json) when the program exits. */
+
+#if defined(AOC_ENABLE_TRACING)
+
+namespace detail {
+    [[nodiscard]] inline u64 traceTimestamp() {
+        return static_cast<u64>(std::chrono::duration_cast<std::chrono::nanoseconds>(
+                                        std::chrono::steady_clock::now().time_since_epoch())
+                                        .count());
+    }
+
+    // appends the zone to the buffer of the calling thread
+    void recordTraceZone(const char* name, u64 start, u64 end);
+}// namespace detail
+
+class TraceZone {
+public:
+    explicit TraceZone(const char* const name) : mName{ name }, mStart{ detail::traceTimestamp() } { }
+
+    TraceZone(const TraceZone&) = delete;
+    TraceZone& operator=(const TraceZone&) = delete;
+
+    ~TraceZone() {
+        detail::recordTraceZone(mName, mStart, detail::traceTimestamp());
+    }
+
+private:
+    const char* mName;
+    u64 mStart;
+};
+
+// writes the zones recorded so far by all threads, none of which may be recording at the same time
+void writeTrace(std::ostream& stream);
+
+#define AOC_TRACE_CONCAT_IMPL(lhs, rhs) lhs##rhs
+#define AOC_TRACE_CONCAT(lhs, rhs) AOC_TRACE_CONCAT_IMPL(lhs, rhs)
+#define AOC_TRACE_ZONE(name) const auto AOC_TRACE_CONCAT(traceZone, __LINE__) = TraceZone{ name }
+
+#else
+
+#define AOC_TRACE_ZONE(name) static_cast<void>(0)
+
+#endif
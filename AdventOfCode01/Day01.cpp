@@ -0,0 +1,35 @@
+#include "Day01.hpp"
+#include "Day01Input.hpp"
+#include "Puzzle.hpp"
+#include "Trace.hpp"
+
+namespace day01 {
+    Readings parse(const std::string_view input) {
+        AOC_TRACE_ZONE("day01::parse");
+        auto readings = Readings{};
+        appendIntegers(input, readings);
+        return readings;
+    }
+
+    uz part1(const Readings& readings) {
+        AOC_TRACE_ZONE("day01::part1");
+        return countIncreases(readings, 1);
+    }
+
+    uz part2(const Readings& readings) {
+        AOC_TRACE_ZONE("day01::part2");
+        // only the reading leaving a sliding window has to be compared to the reading entering it
+        constexpr auto windowSize = uz{ 3 };
+        return countIncreases(readings, windowSize);
+    }
+}// namespace day01
+
+namespace {
+    // the embedded input.txt solved by the compiler, a changed input fails the build until the answers are updated
+    constexpr auto embeddedReadings =
+            integerArray<int, parseIntegers(day01::embedded::input, std::span<int>{})>(day01::embedded::input);
+    static_assert(day01::countIncreases(embeddedReadings, 1) == 1766);
+    static_assert(day01::countIncreases(embeddedReadings, 3) == 1797);
+
+    const auto registration = PuzzleRegistration{ 1, "input.txt", day01::parse, day01::part1, day01::part2 };
+}
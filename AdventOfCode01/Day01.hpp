@@ -0,0 +1,24 @@
+#pragma once
+
+#include "AOCUtilities.hpp"
+#include <span>
+#include <string_view>
+#include <vector>
+
+namespace day01 {
+    using Readings = std::vector<int>;
+
+    /* Number of readings larger than the reading distance readings before them. Two neighboring sliding
+     * windows of that size share all but those two readings, so it is also the number of increasing sums. */
+    [[nodiscard]] constexpr uz countIncreases(const std::span<const int> readings, const uz distance) {
+        auto count = uz{ 0 };
+        for (auto i = distance; i < readings.size(); ++i) {
+            count += static_cast<uz>(readings[i] > readings[i - distance]);
+        }
+        return count;
+    }
+
+    [[nodiscard]] Readings parse(std::string_view input);
+    [[nodiscard]] uz part1(const Readings& readings);
+    [[nodiscard]] uz part2(const Readings& readings);
+}// namespace day01
@@ -0,0 +1,107 @@
+#include "Day02.hpp"
+#include "ParallelParse.hpp"
+#include "Puzzle.hpp"
+#include "Trace.hpp"
+#include <span>
+
+namespace day02 {
+    namespace {
+        struct Vec2i {
+            i64 x{ 0 }, y{ 0 };
+
+            [[nodiscard]] friend Vec2i operator+(Vec2i lhs, const Vec2i& rhs) {
+                return lhs += rhs;
+            }
+
+            [[nodiscard]] friend Vec2i operator*(const Vec2i& vec, const i64 scalar) {
+                return Vec2i{ .x{ vec.x * scalar }, .y{ vec.y * scalar }};
+            }
+
+            [[nodiscard]] friend Vec2i operator*(const i64 scalar, const Vec2i& vec) {
+                return vec * scalar;
+            }
+
+            Vec2i operator+=(const Vec2i& other) {
+                Vec2i oldValue = *this;
+                x += other.x;
+                y += other.y;
+                return oldValue;
+            }
+        };
+
+        [[nodiscard]] Instruction parseLine(const std::string_view line) {
+            const auto spacePosition = line.find(' ');
+            Command command = Command::Forward;
+            const auto commandString = line.substr(0, spacePosition);
+            if (commandString == "up") {
+                command = Command::Up;
+            } else if (commandString == "down") {
+                command = Command::Down;
+            }
+            return Instruction{ command, parseInteger<int>(line.substr(spacePosition + 1)) };
+        }
+    }// namespace
+
+    Instructions parse(const std::string_view input) {
+        AOC_TRACE_ZONE("day02::parse");
+        // test case: expected output is (15, 60) or 900 multiplied
+        // "forward 5", "down 5", "forward 8", "up 3", "down 8", "forward 2"
+        return parseChunked<Instruction>(input, [](const std::string_view chunk, auto& instructions) {
+            for (const auto line : splitLines(chunk)) {
+                instructions.push_back(parseLine(line));
+            }
+        });
+    }
+
+    void serialize(const Instructions& instructions, BinaryWriter& writer) {
+        writer.writeSpan(std::span{ instructions });
+    }
+
+    Instructions deserialize(BinaryReader& reader) {
+        return reader.readVector<Instruction>();
+    }
+
+    i64 part1(const Instructions& instructions) {
+        AOC_TRACE_ZONE("day02::part1");
+        Vec2i position;
+        for (const auto& [command, value] : instructions) {
+            switch (command) {
+                case Command::Forward:
+                    position += Vec2i{ .x{ 1 }, .y{ 0 } } * value;
+                    break;
+                case Command::Up:
+                    position += Vec2i{ .x{ 0 }, .y{ -1 } } * value;
+                    break;
+                case Command::Down:
+                    position += Vec2i{ .x{ 0 }, .y{ 1 } } * value;
+                    break;
+            }
+        }
+        return position.x * position.y;
+    }
+
+    i64 part2(const Instructions& instructions) {
+        AOC_TRACE_ZONE("day02::part2");
+        Vec2i position;
+        i64 aim = 0;
+        for (const auto& [command, value] : instructions) {
+            switch (command) {
+                case Command::Forward:
+                    position += Vec2i{ .x{ value }, .y{ aim * value }};
+                    break;
+                case Command::Up:
+                    aim -= value;
+                    break;
+                case Command::Down:
+                    aim += value;
+                    break;
+            }
+        }
+        return position.x * position.y;
+    }
+}// namespace day02
+
+namespace {
+    const auto registration = PuzzleRegistration{ 2, "input.txt", day02::parse, day02::part1, day02::part2,
+                                                  day02::parseCacheFormat };
+}
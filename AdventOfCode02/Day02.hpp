@@ -0,0 +1,29 @@
+#pragma once
+
+#include "AOCUtilities.hpp"
+#include "ParseCache.hpp"
+#include <string_view>
+#include <vector>
+
+namespace day02 {
+    enum class Command {
+        Forward,
+        Up,
+        Down,
+    };
+
+    struct Instruction {
+        Command command;
+        int value;
+    };
+
+    using Instructions = std::vector<Instruction>;
+
+    [[nodiscard]] Instructions parse(std::string_view input);
+    // parse cache payload: the instructions as one array of Instruction (u32 command, i32 value)
+    void serialize(const Instructions& instructions, BinaryWriter& writer);
+    [[nodiscard]] Instructions deserialize(BinaryReader& reader);
+    inline constexpr auto parseCacheFormat = ParseCacheFormat<Instructions>{ 1, serialize, deserialize };
+    [[nodiscard]] i64 part1(const Instructions& instructions);
+    [[nodiscard]] i64 part2(const Instructions& instructions);
+}// namespace day02
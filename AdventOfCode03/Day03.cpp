@@ -0,0 +1,131 @@
+#include "Day03.hpp"
+#include "Puzzle.hpp"
+#include "Trace.hpp"
+#include <algorithm>
+#include <concepts>
+#include <functional>
+#include <ostream>
+#include <cassert>
+
+namespace day03 {
+    DigitCounter::DigitCounter(std::size_t numDigits) {
+        counts.resize(numDigits);
+    }
+
+    DigitCounter::DigitCounter(const std::string_view numberString) {
+        counts.resize(numberString.length());
+        for (std::size_t i = 0; i < numberString.length(); ++i) {
+            if (numberString[i] == '1') {
+                ++counts[i];
+            } else if (numberString[i] != '0') {
+                assert(false);
+            }
+        }
+    }
+
+    DigitCounter::DigitCounter(std::vector<std::uint32_t> counts) : counts{ std::move(counts) } { }
+
+    DigitCounter::operator std::uint32_t() const {
+        auto result = std::uint32_t{ 0 };
+        for (std::size_t i = 0; i < counts.size(); ++i) {
+            const auto index = counts.size() - 1 - i;
+            result += (counts[index] << i);
+        }
+        return result;
+    }
+
+    DigitCounter DigitCounter::operator+=(const DigitCounter& other) {
+        assert(counts.size() == other.counts.size());
+        auto oldCounts = counts;
+        for (std::size_t i = 0; i < counts.size(); ++i) {
+            counts[i] += other.counts[i];
+        }
+        return DigitCounter{ std::move(oldCounts) };
+    }
+
+    DigitCounter DigitCounter::operator+(const DigitCounter& other) const {
+        return DigitCounter{ counts } += other;
+    }
+
+    DigitCounter DigitCounter::operator~() const {
+        auto resultCounts = counts;
+        for (auto& count : resultCounts) {
+            count = !count;
+        }
+        return resultCounts;
+    }
+
+    std::ostream& operator<<(std::ostream& ostream, const DigitCounter& digitCounter) {
+        if (digitCounter.counts.size() == 0) {
+            return ostream;
+        }
+        ostream << "(" << digitCounter.counts.front();
+        for (std::size_t i = 1; i < digitCounter.counts.size(); ++i) {
+            ostream << "," << digitCounter.counts[i];
+        }
+        ostream << ")";
+        return ostream;
+    }
+
+    namespace {
+        [[nodiscard]] auto getResult(std::vector<DigitCounter> input,
+                                     std::invocable<std::uint32_t, std::uint32_t> auto&& predicate = std::equal_to{}) {
+            const auto numDigits = input.front().counts.size();
+            for (std::size_t i = 0; i < numDigits; ++i) {
+                const auto numberOfOnes = std::count_if(input.begin(), input.end(), [i](const auto& digitCounter) {
+                    return digitCounter.counts[i] == 1;
+                });
+                const auto mostCommon = (numberOfOnes >= input.size() / 2 + (input.size() & 1) ? 1 : 0);
+                input.erase(std::remove_if(input.begin(),
+                                               input.end(),
+                                               [i, mostCommon, &predicate](const auto& digitCounter) {
+                                                   return predicate(digitCounter.counts[i], mostCommon);
+                                               }),
+                            input.end());
+                if (input.size() == 1) {
+                    return static_cast<std::uint32_t>(input.front());
+                }
+            }
+            assert(false);
+            return std::uint32_t{ 0 };
+        }
+    }// namespace
+
+    DiagnosticReport parse(const std::string_view input) {
+        AOC_TRACE_ZONE("day03::parse");
+        /* test case: "00100", "11110", "10110", "10111", "10101", "01111",
+         *            "00111", "11100", "10000", "11001", "00010", "01010" */
+        auto report = DiagnosticReport{};
+        for (const auto numberString : splitLines(input)) {
+            report.emplace_back(numberString);
+        }
+        return report;
+    }
+
+    std::uint32_t part1(const DiagnosticReport& report) {
+        AOC_TRACE_ZONE("day03::part1");
+        assert(!report.empty());
+        auto accumulator = DigitCounter{ report.front().counts.size() };
+        for (const auto& counter : report) {
+            accumulator += counter;
+        }
+        DigitCounter gammaCounter{ accumulator.counts.size() };
+        for (std::size_t i = 0; i < gammaCounter.counts.size(); ++i) {
+            gammaCounter.counts[i] = (accumulator.counts[i] > report.size() / 2 ? 1 : 0);
+        }
+        const auto gamma = static_cast<std::uint32_t>(gammaCounter);
+        const auto epsilon = static_cast<std::uint32_t>(~gammaCounter);
+        return gamma * epsilon;
+    }
+
+    std::uint32_t part2(const DiagnosticReport& report) {
+        AOC_TRACE_ZONE("day03::part2");
+        const auto oxygenRating = getResult(report, std::not_equal_to{});
+        const auto co2scrubberRating = getResult(report, std::equal_to{});
+        return oxygenRating * co2scrubberRating;
+    }
+}// namespace day03
+
+namespace {
+    const auto registration = PuzzleRegistration{ 3, "input.txt", day03::parse, day03::part1, day03::part2 };
+}
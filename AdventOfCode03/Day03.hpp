@@ -0,0 +1,32 @@
+#pragma once
+
+#include "AOCUtilities.hpp"
+#include <iosfwd>
+#include <string_view>
+#include <vector>
+
+namespace day03 {
+    struct DigitCounter {
+        DigitCounter(std::size_t numDigits);
+        DigitCounter(std::string_view numberString);
+        DigitCounter(std::vector<std::uint32_t> counts);
+
+        [[nodiscard]] explicit operator std::uint32_t() const;
+
+        DigitCounter operator+=(const DigitCounter& other);
+        [[nodiscard]] DigitCounter operator+(const DigitCounter& other) const;
+        [[nodiscard]] DigitCounter operator~() const;
+
+        std::vector<std::uint32_t> counts;
+    };
+
+    std::ostream& operator<<(std::ostream& ostream, const DigitCounter& digitCounter);
+
+    using DiagnosticReport = std::vector<DigitCounter>;
+
+    [[nodiscard]] DiagnosticReport parse(std::string_view input);
+    // power consumption
+    [[nodiscard]] std::uint32_t part1(const DiagnosticReport& report);
+    // life support rating
+    [[nodiscard]] std::uint32_t part2(const DiagnosticReport& report);
+}// namespace day03
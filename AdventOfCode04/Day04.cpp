@@ -0,0 +1,128 @@
+#include "Day04.hpp"
+#include "Puzzle.hpp"
+#include "Trace.hpp"
+#include <iomanip>
+#include <numeric>
+#include <ostream>
+#include <span>
+#include <cassert>
+
+namespace day04 {
+    void Board::markValue(const std::uint8_t value) {
+        for (std::size_t y = 0; y < width; ++y) {
+            for (std::size_t x = 0; x < width; ++x) {
+                if (at(x, y).value == value) {
+                    at(x, y).marked = true;
+                    return;
+                }
+            }
+        }
+    }
+
+    bool Board::hasWon() const {
+        for (std::size_t y = 0; y < width; ++y) {
+            bool success = true;
+            for (std::size_t x = 0; x < width; ++x) {
+                if (!at(x, y).marked) {
+                    success = false;
+                    break;
+                }
+            }
+            if (success) {
+                return true;
+            }
+        }
+        for (std::size_t x = 0; x < width; ++x) {
+            bool success = true;
+            for (std::size_t y = 0; y < width; ++y) {
+                if (!at(x, y).marked) {
+                    success = false;
+                    break;
+                }
+            }
+            if (success) {
+                return true;
+            }
+        }
+        return false;
+    }
+
+    std::ostream& operator<<(std::ostream& ostream, const Board& board) {
+        for (std::size_t y = 0; y < 5; ++y) {
+            for (std::size_t x = 0; x < 5; ++x) {
+                ostream << std::setw(4) << static_cast<int>(board.at(x, y).value);
+            }
+            ostream << "\n";
+        }
+        return ostream;
+    }
+
+    namespace {
+        std::uint32_t calculateScore(const Board& board, const std::uint8_t mostRecentNumber) {
+            const auto sum = std::accumulate(board.cells.begin(), board.cells.end(), std::uint32_t{ 0 },
+                                            [](const auto previous, const auto& cell) {
+                                                return previous + static_cast<std::uint32_t>(cell.value) * static_cast<std::uint32_t>(!cell.marked);
+                                            });
+            return sum * static_cast<std::uint32_t>(mostRecentNumber);
+        }
+    }// namespace
+
+    Game parse(const std::string_view input) {
+        AOC_TRACE_ZONE("day04::parse");
+        const auto lines = splitLines(input);
+        auto game = Game{};
+        appendIntegers(lines.front(), game.randomNumbers);
+        std::size_t nextRow = 0;
+        for (std::size_t i = 1; i < lines.size(); ++i) {
+            if (lines[i].empty()) {
+                continue;
+            }
+            if (nextRow == 0) {
+                game.boards.emplace_back(Board{});
+            }
+            std::array<std::uint8_t, Board::width> numbersInCurrentRow{};
+            [[maybe_unused]] const auto numColumns = parseIntegers(lines[i], std::span{ numbersInCurrentRow });
+            assert(numColumns == Board::width);
+            for (std::size_t column = 0; column < numbersInCurrentRow.size(); ++column) {
+                game.boards.back().at(column, nextRow).value = numbersInCurrentRow[column];
+            }
+            nextRow = (nextRow + 1) % 5;
+        }
+        return game;
+    }
+
+    std::uint32_t part1(const Game& game) {
+        AOC_TRACE_ZONE("day04::part1");
+        auto boards = game.boards;
+        for (const auto randomNumber : game.randomNumbers) {
+            for (auto& board : boards) {
+                board.markValue(randomNumber);
+                if (board.hasWon()) {
+                    return calculateScore(board, randomNumber);
+                }
+            }
+        }
+        return 0;
+    }
+
+    std::uint32_t part2(const Game& game) {
+        AOC_TRACE_ZONE("day04::part2");
+        auto boards = game.boards;
+        for (const auto randomNumber : game.randomNumbers) {
+            for (auto& board : boards) {
+                board.markValue(randomNumber);
+            }
+            if (boards.size() == 1 && boards.front().hasWon()) {
+                return calculateScore(boards.front(), randomNumber);
+            }
+            std::erase_if(boards, [](const auto& board) {
+                return board.hasWon();
+            });
+        }
+        return 0;
+    }
+}// namespace day04
+
+namespace {
+    const auto registration = PuzzleRegistration{ 4, "input.txt", day04::parse, day04::part1, day04::part2 };
+}
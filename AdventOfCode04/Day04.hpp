@@ -0,0 +1,43 @@
+#pragma once
+
+#include "AOCUtilities.hpp"
+#include <array>
+#include <iosfwd>
+#include <string_view>
+#include <vector>
+
+namespace day04 {
+    struct Cell {
+        std::uint8_t value{ 0 };
+        bool marked{ false };
+    };
+
+    struct Board {
+        Cell& at(const std::size_t x, const std::size_t y) {
+            return cells.at(x + y * width);
+        }
+
+        [[nodiscard]] const Cell& at(const std::size_t x, const std::size_t y) const {
+            return cells.at(x + y * width);
+        }
+
+        void markValue(std::uint8_t value);
+        [[nodiscard]] bool hasWon() const;
+
+        static constexpr auto width = std::size_t{ 5 };
+        std::array<Cell, width * width> cells;
+    };
+
+    std::ostream& operator<<(std::ostream& ostream, const Board& board);
+
+    struct Game {
+        std::vector<std::uint8_t> randomNumbers;
+        std::vector<Board> boards;
+    };
+
+    [[nodiscard]] Game parse(std::string_view input);
+    // score of the first board to win
+    [[nodiscard]] std::uint32_t part1(const Game& game);
+    // score of the last board to win
+    [[nodiscard]] std::uint32_t part2(const Game& game);
+}// namespace day04
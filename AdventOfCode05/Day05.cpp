@@ -0,0 +1,115 @@
+#include "Day05.hpp"
+#include "GridRenderer.hpp"
+#include "ParallelParse.hpp"
+#include "Puzzle.hpp"
+#include "Trace.hpp"
+#include <algorithm>
+#include <ostream>
+#include <span>
+#include <cassert>
+
+namespace day05 {
+    std::size_t Map::countTilesGreaterOrEqual(const u32 threshold) const {
+        AOC_TRACE_ZONE("day05::Map::countTilesGreaterOrEqual");
+        auto count = std::size_t{ 0 };
+        for (auto y = std::size_t{ 0 }; y < height(); ++y) {
+            const auto row = mTiles.row(y);
+            count += static_cast<std::size_t>(
+                    std::count_if(row.begin(), row.end(), [threshold](const u32 tile) { return tile >= threshold; }));
+        }
+        return count;
+    }
+
+    std::ostream& operator<<(std::ostream& ostream, const PointU32& point) {
+        ostream << "(" << point.x << "," << point.y << ")";
+        return ostream;
+    }
+
+    std::ostream& operator<<(std::ostream& ostream, const Map& map) {
+        GridRenderer{ map.width(), map.height() }
+                .cells([&](const uz x, const uz y) {
+                    const auto tile = map.get({ static_cast<u32>(x), static_cast<u32>(y) });
+                    return tile == 0 ? '.' : static_cast<char>('0' + tile % 10);
+                })
+                .write(ostream);
+        return ostream;
+    }
+
+    Segments parse(const std::string_view input) {
+        AOC_TRACE_ZONE("day05::parse");
+        return parseChunked<Segment>(input, [](const std::string_view chunk, auto& segments) {
+            for (const auto line : splitLines(chunk)) {
+                std::array<u32, 4> coordinates{};
+                [[maybe_unused]] const auto numCoordinates = parseIntegers(line, std::span{ coordinates });
+                assert(numCoordinates == coordinates.size());
+                segments.push_back(Segment{
+                    PointU32{ coordinates[0], coordinates[1] },
+                    PointU32{ coordinates[2], coordinates[3] },
+                });
+            }
+        });
+    }
+
+    void serialize(const Segments& segments, BinaryWriter& writer) {
+        writer.writeSpan(std::span{ segments });
+    }
+
+    Segments deserialize(BinaryReader& reader) {
+        return reader.readVector<Segment>();
+    }
+
+    Map drawSegments(const Segments& segments, const bool includeDiagonals) {
+        AOC_TRACE_ZONE("day05::drawSegments");
+        auto width = std::size_t{ 0 };
+        auto height = std::size_t{ 0 };
+        for (const auto& points : segments) {
+            width = std::max<std::size_t>(width, std::max(points[0].x, points[1].x) + 1);
+            height = std::max<std::size_t>(height, std::max(points[0].y, points[1].y) + 1);
+        }
+        auto result = Map{ width, height };
+        for (const auto& points : segments) {
+            const auto sameX = (points[0].x == points[1].x);
+            const auto sameY = (points[0].y == points[1].y);
+            if (sameX && !sameY) {
+                const auto minY = std::min(points[0].y, points[1].y);
+                const auto maxY = std::max(points[0].y, points[1].y);
+                for (u32 y = minY; y <= maxY; ++y) {
+                    result.increase({ points[0].x, y });
+                }
+                continue;
+            } else if (!sameX && sameY) {
+                const auto minX = std::min(points[0].x, points[1].x);
+                const auto maxX = std::max(points[0].x, points[1].x);
+                for (u32 x = minX; x <= maxX; ++x) {
+                    result.increase({x, points[0].y});
+                }
+                continue;
+            }
+            if (includeDiagonals) {
+                const auto leftPoint = (points[0].x < points[1].x ? points[0] : points[1]);
+                const auto rightPoint = (points[0].x < points[1].x ? points[1] : points[0]);
+                const auto increment = (leftPoint.y < rightPoint.y ? 1 : -1);
+                auto y = leftPoint.y;
+                for (u32 x = leftPoint.x; x <= rightPoint.x; ++x, y = static_cast<u32>(static_cast<int>(y) + increment)) {
+                    result.increase({ x, y });
+                }
+            }
+        }
+        return result;
+    }
+
+    std::size_t part1(const Segments& segments) {
+        AOC_TRACE_ZONE("day05::part1");
+        return drawSegments(segments, false).countTilesGreaterOrEqual(2);
+    }
+
+    std::size_t part2(const Segments& segments) {
+        AOC_TRACE_ZONE("day05::part2");
+        return drawSegments(segments, true).countTilesGreaterOrEqual(2);
+    }
+}// namespace day05
+
+namespace {
+    const auto registration = PuzzleRegistration{ 5, "input.txt", day05::parse, day05::part1, day05::part2,
+                                                  day05::parseCacheFormat };
+}
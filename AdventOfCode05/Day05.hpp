@@ -0,0 +1,56 @@
+#pragma once
+
+#include "AOCUtilities.hpp"
+#include "Grid.hpp"
+#include "ParseCache.hpp"
+#include <array>
+#include <iosfwd>
+#include <string_view>
+#include <vector>
+
+namespace day05 {
+    // how many segments cover each tile, the coordinates are small enough for a dense grid
+    class Map {
+    public:
+        Map(const std::size_t width, const std::size_t height) : mTiles{ width, height } { }
+
+        [[nodiscard]] u32 get(const PointU32 coordinates) const {
+            return mTiles(coordinates);
+        }
+
+        void increase(const PointU32 coordinates) {
+            ++mTiles(coordinates);
+        }
+
+        [[nodiscard]] std::size_t width() const {
+            return mTiles.width();
+        }
+
+        [[nodiscard]] std::size_t height() const {
+            return mTiles.height();
+        }
+
+        [[nodiscard]] std::size_t countTilesGreaterOrEqual(u32 threshold) const;
+
+    private:
+        Grid<u32> mTiles;
+    };
+
+    std::ostream& operator<<(std::ostream& ostream, const PointU32& point);
+    std::ostream& operator<<(std::ostream& ostream, const Map& map);
+
+    // "x1,y1 -> x2,y2"
+    using Segment = std::array<PointU32, 2>;
+    using Segments = std::vector<Segment>;
+
+    [[nodiscard]] Segments parse(std::string_view input);
+    // parse cache payload: the segments as one array of Segment (u32 x1, y1, x2, y2)
+    void serialize(const Segments& segments, BinaryWriter& writer);
+    [[nodiscard]] Segments deserialize(BinaryReader& reader);
+    inline constexpr auto parseCacheFormat = ParseCacheFormat<Segments>{ 1, serialize, deserialize };
+    [[nodiscard]] Map drawSegments(const Segments& segments, bool includeDiagonals);
+    // overlaps of horizontal and vertical segments
+    [[nodiscard]] std::size_t part1(const Segments& segments);
+    // overlaps of all segments
+    [[nodiscard]] std::size_t part2(const Segments& segments);
+}// namespace day05
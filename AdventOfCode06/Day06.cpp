@@ -0,0 +1,45 @@
+#include "Day06.hpp"
+#include "Puzzle.hpp"
+#include "Trace.hpp"
+#include <array>
+#include <numeric>
+
+namespace day06 {
+    Population parse(const std::string_view input) {
+        AOC_TRACE_ZONE("day06::parse");
+        auto population = Population{};
+        appendIntegers(splitLines(input).front(), population);
+        return population;
+    }
+
+    std::size_t populationAfterTime(const Population& startingPopulation, const Days days) {
+        AOC_TRACE_ZONE("day06::populationAfterTime");
+        std::array<u64, 9> fishWithCounters{};
+        for (const auto fish : startingPopulation) {
+            ++fishWithCounters.at(fish);
+        }
+        for (Days day = 0; day < days; ++day) {
+            u64 fishToSpawn = fishWithCounters.at(0);
+            for (uz counter = 0; counter < fishWithCounters.size() - 1; ++counter) {
+                fishWithCounters.at(counter) = fishWithCounters.at(counter + 1);
+            }
+            fishWithCounters.at(6) += fishToSpawn;
+            fishWithCounters.at(8) = fishToSpawn;
+        }
+        return std::accumulate(begin(fishWithCounters), end(fishWithCounters), u64{ 0 });
+    }
+
+    std::size_t part1(const Population& population) {
+        AOC_TRACE_ZONE("day06::part1");
+        return populationAfterTime(population, 80);
+    }
+
+    std::size_t part2(const Population& population) {
+        AOC_TRACE_ZONE("day06::part2");
+        return populationAfterTime(population, 256);
+    }
+}// namespace day06
+
+namespace {
+    const auto registration = PuzzleRegistration{ 6, "input.txt", day06::parse, day06::part1, day06::part2 };
+}
@@ -0,0 +1,18 @@
+#pragma once
+
+#include "AOCUtilities.hpp"
+#include <string_view>
+#include <vector>
+
+namespace day06 {
+    using Fish = u8;
+    using Days = u32;
+    using Population = std::vector<Fish>;
+
+    [[nodiscard]] Population parse(std::string_view input);
+    [[nodiscard]] std::size_t populationAfterTime(const Population& startingPopulation, Days days);
+    // population after 80 days
+    [[nodiscard]] std::size_t part1(const Population& population);
+    // population after 256 days
+    [[nodiscard]] std::size_t part2(const Population& population);
+}// namespace day06
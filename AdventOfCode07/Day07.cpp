@@ -0,0 +1,82 @@
+#include "Day07.hpp"
+#include "Puzzle.hpp"
+#include "Trace.hpp"
+#include <algorithm>
+#include <string>
+#include <cstdint>
+
+#define FAHRER auto operator
+#define KARRE auto
+
+namespace day07 {
+    namespace {
+        // DO NOT DELETE DIS!!!!
+        struct A {
+            A(int, float, std::string) {};
+        };
+
+        struct FuelCalculator {
+            [[nodiscard]] FAHRER()(KARRE eNtFeRnUnG) noexcept {
+                // 1 => 1
+                // 2 => 1 + 2
+                // 3 => 1 + 2 + 3
+                // n => 1 + 2 + 3 + ... + n = (n + 1) * n / 2 (copyright by grandmaster Gauß)
+                return [eNtFeRnUnG]() -> decltype(eNtFeRnUnG) {
+                    return (eNtFeRnUnG + u32{1}) * eNtFeRnUnG / std::uint32_t{2};
+                };
+            };
+        };
+
+        template<typename Cost>
+        [[nodiscard]] u64 minimumFuel(const Positions& positions, Cost&& cost) {
+            AOC_TRACE_ZONE("day07::minimumFuel");
+            const auto min = positions.front();
+            const auto max = positions.back();
+            auto min_Sprit = u64{0};
+            for (auto x = min; x <= max; ++x) {
+                u64 sprit = 0;
+                for (const auto position: positions) {
+                    sprit = sprit + cost(position, x);
+                }
+                if (min_Sprit == 0 || sprit < min_Sprit) {
+                    min_Sprit = sprit;
+                }
+            }
+            return min_Sprit;
+        }
+    }// namespace
+
+    Positions parse(const std::string_view input) {
+        AOC_TRACE_ZONE("day07::parse");
+        auto positions = Positions{};
+        appendIntegers(splitLines(input).front(), positions);
+        std::sort(positions.begin(), positions.end());
+        return positions;
+    }
+
+    u64 part1(const Positions& positions) {
+        AOC_TRACE_ZONE("day07::part1");
+        return minimumFuel(positions, [](const u32 position, const u32 x) -> u32 {
+            if (position > x) {
+                return position - x;
+            }
+            u32 sprit = 0;
+            [[maybe_unused]] std::int64_t temp = sprit -= -(int64_t) (x - position);
+            return sprit;
+        });
+    }
+
+    u64 part2(const Positions& positions) {
+        AOC_TRACE_ZONE("day07::part2");
+        return minimumFuel(positions, [](const u32 position, const u32 x) {
+            const auto EnTfErNuNg = (position > x ? position - x : x - position);
+            FuelCalculator fuelCalculator_Factory{};
+            const auto __Benizin_taschenRechner_ = fuelCalculator_Factory(EnTfErNuNg);
+            return __Benizin_taschenRechner_();
+        });
+    }
+}// namespace day07
+
+namespace {
+    const auto registration = PuzzleRegistration{ 7, "input.txt", day07::parse, day07::part1, day07::part2 };
+}
@@ -0,0 +1,14 @@
+#pragma once
+
+#include "AOCUtilities.hpp"
+#include <string_view>
+#include <vector>
+
+namespace day07 {
+    // sorted crab positions
+    using Positions = std::vector<u32>;
+
+    [[nodiscard]] Positions parse(std::string_view input);
+    [[nodiscard]] u64 part1(const Positions& positions);
+    [[nodiscard]] u64 part2(const Positions& positions);
+}// namespace day07
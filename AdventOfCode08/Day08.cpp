@@ -0,0 +1,188 @@
+#include "Day08.hpp"
+#include "Arena.hpp"
+#include "Puzzle.hpp"
+#include "ThreadPool.hpp"
+#include "Trace.hpp"
+#include <algorithm>
+#include <functional>
+#include <memory_resource>
+#include <string>
+#include <unordered_map>
+#include <cassert>
+
+namespace day08 {
+    namespace {
+        /* The digit strings have at most 7 characters and never leave the small string buffer, the containers
+         * holding them are allocated from an arena that is reset for every entry. */
+        using Mappings = std::pmr::unordered_map<std::string, u8>;
+        using DigitStrings = std::pmr::vector<std::string>;
+
+        [[nodiscard]] std::string popByLength(DigitStrings& strings, uz length) {
+            const auto findIterator = std::find_if(strings.begin(), strings.end(), [length](const auto& string) {
+                return string.length() == length;
+            });
+            assert(findIterator != strings.end());
+            auto result = std::move(*findIterator);
+            strings.erase(findIterator);
+            return result;
+        }
+
+        [[nodiscard]] std::string difference(std::string minuend, const std::string& subtrahend) {
+            for (const auto toErase : subtrahend) {
+                minuend.erase(std::remove(minuend.begin(), minuend.end(), toErase), minuend.end());
+            }
+            return minuend;
+        }
+
+        [[nodiscard]] std::string findKey(const Mappings& mappings, const u8 value) {
+            const auto it = std::find_if(mappings.begin(), mappings.end(), [value](const auto& pair) {
+                return pair.second == value;
+            });
+            return it->first;
+        }
+
+        [[nodiscard]] bool isSubsetOf(const std::string& subset, const std::string& superset) {
+            for (const auto c : subset) {
+                if (superset.find(c) == std::string::npos) {
+                    return false;
+                }
+            }
+            return true;
+        }
+
+        [[nodiscard]] u32 decode(const Entry& entry, std::pmr::memory_resource* const resource) {
+            AOC_TRACE_ZONE("day08::decode");
+            auto mappings = Mappings{ resource };
+            mappings.reserve(entry.patterns.size());
+            auto digitStrings = DigitStrings{ resource };
+            digitStrings.reserve(entry.patterns.size());
+            for (const auto pattern : entry.patterns) {
+                auto& digitString = digitStrings.emplace_back(pattern);
+                std::sort(digitString.begin(), digitString.end());
+            }
+            mappings[popByLength(digitStrings, 2)] = 1;
+            mappings[popByLength(digitStrings, 3)] = 7;
+            mappings[popByLength(digitStrings, 4)] = 4;
+            mappings[popByLength(digitStrings, 7)] = 8;
+            const auto a = difference(findKey(mappings, 7), findKey(mappings, 1));
+
+            // NINE = genau wie 4 + a und einem weiteren (nämlich g)
+            auto nineStringHelper = findKey(mappings, 4) + a; // still missing the letter that maps to g
+            const auto nineIterator = std::find_if(digitStrings.begin(), digitStrings.end(),
+                                                   [&nineStringHelper](const auto& string) {
+                if (string.length() != nineStringHelper.length() + 1) {
+                    return false;
+                }
+                for (const auto c : nineStringHelper) {
+                    if (string.find(c) == std::string::npos) {
+                        return false;
+                    }
+                }
+                return true;
+            });
+            auto nineString = *nineIterator;
+            digitStrings.erase(nineIterator);
+            std::sort(nineString.begin(), nineString.end());
+            mappings[nineString] = 9;
+            const auto e = difference(findKey(mappings, 8), findKey(mappings, 9));
+
+            // TWO = einzige fünfstellige Kombination mit e
+            const auto twoIterator = std::find_if(digitStrings.begin(), digitStrings.end(), [&e](const auto& string) {
+                return string.length() == 5 && string.find(e) != std::string::npos;
+            });
+            assert(twoIterator != digitStrings.end());
+            mappings[*twoIterator] = 2;
+            digitStrings.erase(twoIterator);
+
+            // ZERO = sechsstellige Zahl, die nicht NINE ist und ONE enthält
+            const auto zeroIterator = std::find_if(digitStrings.begin(), digitStrings.end(),
+                                                   [nine = findKey(mappings, 9), one = findKey(mappings, 1)](const auto& string) {
+                return string.length() == 6 && string != nine && isSubsetOf(one, string);
+            });
+            assert(zeroIterator != digitStrings.end());
+            mappings[*zeroIterator] = 0;
+            digitStrings.erase(zeroIterator);
+
+            // SIX = sechsstellige Zahl, die nicht ZERO ist und nicht NINE ist
+            const auto sixIterator = std::find_if(digitStrings.begin(), digitStrings.end(),
+                                                  [zero = findKey(mappings, 0), nine = findKey(mappings, 9)](const auto& string) {
+                return string.length() == 6 && string != zero && string != nine;
+            });
+            assert(sixIterator != digitStrings.end());
+            mappings[*sixIterator] = 6;
+            digitStrings.erase(sixIterator);
+
+            // THREE = fünfstellige Zahl, die ONE enthält
+            const auto threeIterator = std::find_if(digitStrings.begin(), digitStrings.end(),
+                                                    [one = findKey(mappings, 1)](const auto& string) {
+                return string.length() == 5 && isSubsetOf(one, string);
+            });
+            assert(threeIterator != digitStrings.end());
+            mappings[*threeIterator] = 3;
+            digitStrings.erase(threeIterator);
+            assert(digitStrings.size() == 1);
+            // FIVE = fünfstellige Zahl, die nicht THREE ist und nicht TWO ist
+            // (easier: last remaining digit)
+            mappings[digitStrings.front()] = 5;
+            assert(mappings.size() == 10);
+
+            auto decoded = u32{ 0 };
+            u32 factor = 1000;
+            for (uz i = 0; i < entry.outputs.size(); ++i, factor /= 10) {
+                auto sorted = std::string{ entry.outputs[i] };
+                std::sort(sorted.begin(), sorted.end());
+                decoded += mappings[sorted] * factor;
+            }
+            return decoded;
+        }
+    }// namespace
+
+    Entries parse(const std::string_view input) {
+        AOC_TRACE_ZONE("day08::parse");
+        auto entries = Entries{};
+        for (const auto line : splitLines(input)) {
+            std::array<std::string_view, 2> parts;
+            splitInto(line, parts, '|');
+            auto& entry = entries.emplace_back();
+            [[maybe_unused]] const auto numPatterns = splitInto(parts.front(), entry.patterns, ' ');
+            assert(numPatterns == entry.patterns.size());
+            [[maybe_unused]] const auto numOutputs = splitInto(parts.back(), entry.outputs, ' ');
+            assert(numOutputs == entry.outputs.size());
+        }
+        return entries;
+    }
+
+    u32 part1(const Entries& entries) {
+        AOC_TRACE_ZONE("day08::part1");
+        // segment counts of 1, 7, 4 and 8 are unique
+        const auto mappings = std::unordered_map<uz, u8>{
+                { 2, 1 },
+                { 3, 7 },
+                { 4, 4 },
+                { 7, 8 }
+        };
+        auto accumulator = u32{ 0 };
+        for (const auto& entry : entries) {
+            for (const auto output : entry.outputs) {
+                accumulator += static_cast<u32>(mappings.contains(output.length()));
+            }
+        }
+        return accumulator;
+    }
+
+    u32 part2(const Entries& entries) {
+        AOC_TRACE_ZONE("day08::part2");
+        // the entries are independent, every one is decoded with its own arena on the stack of its thread
+        return parallelReduce(
+                uz{ 0 }, entries.size(), u32{ 0 },
+                [&entries](const uz i) {
+                    auto arena = Arena{};
+                    return decode(entries[i], arena.resource());
+                },
+                std::plus<>{});
+    }
+}// namespace day08
+
+namespace {
+    const auto registration = PuzzleRegistration{ 8, "input.txt", day08::parse, day08::part1, day08::part2 };
+}
@@ -0,0 +1,22 @@
+#pragma once
+
+#include "AOCUtilities.hpp"
+#include <array>
+#include <string_view>
+#include <vector>
+
+namespace day08 {
+    // views into the puzzle input
+    struct Entry {
+        std::array<std::string_view, 10> patterns;
+        std::array<std::string_view, 4> outputs;
+    };
+
+    using Entries = std::vector<Entry>;
+
+    [[nodiscard]] Entries parse(std::string_view input);
+    // number of 1s, 4s, 7s and 8s in the outputs
+    [[nodiscard]] u32 part1(const Entries& entries);
+    // sum of all decoded outputs
+    [[nodiscard]] u32 part2(const Entries& entries);
+}// namespace day08
@@ -0,0 +1,112 @@
+#include "Day09.hpp"
+#include "GridRenderer.hpp"
+#include "Puzzle.hpp"
+#include "SmallVector.hpp"
+#include "Trace.hpp"
+#include <algorithm>
+#include <array>
+#include <functional>
+#include <ostream>
+
+namespace day09 {
+    Map Map::fromLines(const std::vector<std::string_view>& lines) {
+        AOC_TRACE_ZONE("day09::Map::fromLines");
+        const auto width = lines.front().length();
+        const auto height = lines.size();
+        auto result = Map{width, height};
+        for (uz y = 0; y < height; ++y) {
+            const auto line = lines.at(y);
+            const auto row = result.mTiles.row(y);
+            for (uz x = 0; x < width; ++x) {
+                row[x] = static_cast<u8>(line.at(x) - '0');
+            }
+        }
+        return result;
+    }
+
+    bool Map::isLowPoint(const uz x, const uz y) const {
+        // the padding makes the neighbors of the border valid, they are never lower than any tile
+        const auto tileHeight = mTiles(x, y);
+        return mTiles(x, y - 1) > tileHeight && mTiles(x, y + 1) > tileHeight && mTiles(x - 1, y) > tileHeight &&
+               mTiles(x + 1, y) > tileHeight;
+    }
+
+    u32 Map::calculateRiskLevelsOfLowPoints() const {
+        AOC_TRACE_ZONE("day09::Map::calculateRiskLevelsOfLowPoints");
+        auto riskLevels = u32{0};
+        for (uz y = 0; y < height(); ++y) {
+            for (uz x = 0; x < width(); ++x) {
+                riskLevels += static_cast<u32>(mTiles(x, y) + 1) * static_cast<u32>(isLowPoint(x, y));
+            }
+        }
+        return riskLevels;
+    }
+
+    u64 Map::productOfThreeGreatestBasins() const {
+        AOC_TRACE_ZONE("day09::Map::productOfThreeGreatestBasins");
+        std::vector<uz> basinSizes;
+        // the basins are separated by heights of 9, so no tile is visited twice and the grid is never cleared
+        auto visited = Grid<u8>{ width(), height(), 0, 1 };
+        const auto neighborOffsets = std::array{
+                uz{ 0 } - mTiles.stride(), // up
+                mTiles.stride(),           // down
+                uz{ 1 },                   // right
+                uz{ 0 } - 1,               // left
+        };
+        // the frontier of a basin rarely holds more than a few dozen tiles
+        auto toVisit = SmallVector<uz, 128>{};
+        for (uz y = 0; y < height(); ++y) {
+            for (uz x = 0; x < width(); ++x) {
+                if (!isLowPoint(x, y)) {
+                    continue;
+                }
+                // find size of basin, working on the indices of the cells
+                auto basinSize = uz{ 0 };
+                toVisit.push_back(mTiles.indexOf(x, y));
+                visited[toVisit.back()] = 1;
+                while (!toVisit.empty()) {
+                    const auto index = toVisit.back();
+                    toVisit.pop_back();
+                    ++basinSize;
+                    for (const auto offset : neighborOffsets) {
+                        const auto neighbor = index + offset;
+                        if (mTiles[neighbor] < highest && visited[neighbor] == 0) {
+                            visited[neighbor] = 1;
+                            toVisit.push_back(neighbor);
+                        }
+                    }
+                }
+                basinSizes.emplace_back(basinSize);
+            }
+        }
+        //std::partial_sort(begin(basinSizes), begin(basinSizes) + 3, end(basinSizes), std::greater{});
+        std::nth_element(begin(basinSizes), begin(basinSizes) + 3, end(basinSizes), std::greater{});
+        return basinSizes.front() * basinSizes.at(1) * basinSizes.at(2);
+    }
+
+    std::ostream &operator<<(std::ostream &ostream, const Map &map) {
+        GridRenderer{ map.width(), map.height() }
+                .cells([&](const uz x, const uz y) { return static_cast<char>('0' + map.at(x, y)); })
+                .write(ostream);
+        return ostream;
+    }
+
+    Map parse(const std::string_view input) {
+        AOC_TRACE_ZONE("day09::parse");
+        return Map::fromLines(splitLines(input));
+    }
+
+    u32 part1(const Map& map) {
+        AOC_TRACE_ZONE("day09::part1");
+        return map.calculateRiskLevelsOfLowPoints();
+    }
+
+    u64 part2(const Map& map) {
+        AOC_TRACE_ZONE("day09::part2");
+        return map.productOfThreeGreatestBasins();
+    }
+}// namespace day09
+
+namespace {
+    const auto registration = PuzzleRegistration{ 9, "input.txt", day09::parse, day09::part1, day09::part2 };
+}
@@ -0,0 +1,52 @@
+#pragma once
+
+#include "AOCUtilities.hpp"
+#include "Grid.hpp"
+#include <iosfwd>
+#include <string_view>
+#include <vector>
+
+namespace day09 {
+    class Map {
+    public:
+        // heights of 9 never belong to a basin, so they are used for the padding as well
+        static constexpr auto highest = u8{ 9 };
+
+        Map(uz width, uz height) : mTiles{ width, height, highest, 1 } { }
+
+        [[nodiscard]] static Map fromLines(const std::vector<std::string_view>& lines);
+
+        // part 1
+        [[nodiscard]] u32 calculateRiskLevelsOfLowPoints() const;
+        // part 2
+        [[nodiscard]] u64 productOfThreeGreatestBasins() const;
+
+        u8& at(uz x, uz y) {
+            return mTiles.at(x, y);
+        }
+
+        [[nodiscard]] u8 at(uz x, uz y) const {
+            return mTiles.at(x, y);
+        }
+
+        [[nodiscard]] uz width() const {
+            return mTiles.width();
+        }
+
+        [[nodiscard]] uz height() const {
+            return mTiles.height();
+        }
+
+    private:
+        [[nodiscard]] bool isLowPoint(uz x, uz y) const;
+
+    private:
+        Grid<u8> mTiles;
+    };
+
+    std::ostream& operator<<(std::ostream& ostream, const Map& map);
+
+    [[nodiscard]] Map parse(std::string_view input);
+    [[nodiscard]] u32 part1(const Map& map);
+    [[nodiscard]] u64 part2(const Map& map);
+}// namespace day09
@@ -0,0 +1,103 @@
+#include "Day10.hpp"
+#include "Median.hpp"
+#include "Puzzle.hpp"
+#include "Trace.hpp"
+#include <array>
+#include <optional>
+#include <stack>
+
+namespace day10 {
+    namespace {
+        struct TokenPair {
+            char open;
+            char close;
+            u64 corruptScore;
+            u64 completionScore;
+        };
+
+        constexpr auto tokenPairs = std::array{
+                TokenPair{ '(', ')', 3, 1 },
+                TokenPair{ '[', ']', 57, 2 },
+                TokenPair{ '{', '}', 1197, 3 },
+                TokenPair{ '<', '>', 25137, 4 },
+        };
+
+        [[nodiscard]] std::optional<u64> getCorruptScore(const std::string_view line, std::stack<char>& tokenStack) {
+            auto score = u64{ 0 };
+            for (const auto c : line) {
+                for (auto tokenPair : tokenPairs) {
+                    if (c == tokenPair.open) {
+                        tokenStack.push(tokenPair.close);
+                        break;
+                    }
+                    if (c == tokenPair.close) {
+                        if (tokenStack.empty() || tokenStack.top() != tokenPair.close) {
+                            // corrupt line
+                            score += tokenPair.corruptScore;
+                            return score;
+                        } else {
+                            tokenStack.pop();
+                        }
+                    }
+                }
+            }
+            return {};
+        }
+
+        [[nodiscard]] std::optional<u64> getCompletionScore(std::stack<char>& tokenStack) {
+            if (tokenStack.empty()) {
+                return {};
+            }
+            auto totalScore = u64{ 0 };
+            while (!tokenStack.empty()) {
+                totalScore *= 5;
+                for (const auto& tokenPair : tokenPairs) {
+                    if (tokenStack.top() == tokenPair.close) {
+                        totalScore += tokenPair.completionScore;
+                        break;
+                    }
+                }
+                tokenStack.pop();
+            }
+            return totalScore;
+        }
+    }// namespace
+
+    Lines parse(const std::string_view input) {
+        AOC_TRACE_ZONE("day10::parse");
+        return splitLines(input);
+    }
+
+    u64 part1(const Lines& lines) {
+        AOC_TRACE_ZONE("day10::part1");
+        auto corruptScore = u64{ 0 };
+        for (const auto line : lines) {
+            std::stack<char> tokenStack;
+            const auto currentCorruptScore = getCorruptScore(line, tokenStack);
+            if (currentCorruptScore) {
+                corruptScore += currentCorruptScore.value();
+            }
+        }
+        return corruptScore;
+    }
+
+    u64 part2(const Lines& lines) {
+        AOC_TRACE_ZONE("day10::part2");
+        auto completionScores = StreamingMedian<u64>{};
+        for (const auto line : lines) {
+            std::stack<char> tokenStack;
+            if (getCorruptScore(line, tokenStack)) {
+                continue;
+            }
+            const auto currentCompletionScore = getCompletionScore(tokenStack);
+            if (currentCompletionScore) {
+                completionScores.push(currentCompletionScore.value());
+            }
+        }
+        return completionScores.median();
+    }
+}// namespace day10
+
+namespace {
+    const auto registration = PuzzleRegistration{ 10, "input.txt", day10::parse, day10::part1, day10::part2 };
+}
@@ -0,0 +1,16 @@
+#pragma once
+
+#include "AOCUtilities.hpp"
+#include <string_view>
+#include <vector>
+
+namespace day10 {
+    // views into the puzzle input
+    using Lines = std::vector<std::string_view>;
+
+    [[nodiscard]] Lines parse(std::string_view input);
+    // total syntax error score of the corrupted lines
+    [[nodiscard]] u64 part1(const Lines& lines);
+    // median completion score of the incomplete lines
+    [[nodiscard]] u64 part2(const Lines& lines);
+}// namespace day10
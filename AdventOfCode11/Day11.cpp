@@ -0,0 +1,79 @@
+#include "Day11.hpp"
+#include "Puzzle.hpp"
+#include "Trace.hpp"
+#include <array>
+#include <stdexcept>
+
+namespace day11 {
+    Cavern Cavern::fromLines(const std::vector<std::string_view>& lines) {
+        AOC_TRACE_ZONE("day11::Cavern::fromLines");
+        auto result = Cavern{ lines.front().length(), lines.size() };
+        for (auto y = uz{ 0 }; y < lines.size(); ++y) {
+            const auto row = result.mEnergy.row(y);
+            for (auto x = uz{ 0 }; x < row.size(); ++x) {
+                row[x] = static_cast<u8>(lines[y].at(x) - '0');
+            }
+        }
+        return result;
+    }
+
+    uz Cavern::step() {
+        mFlashed.fill(false);
+        const auto raise = [&](const uz x, const uz y) {
+            if (!mFlashed(x, y) && ++mEnergy(x, y) > maxEnergy) {
+                mFlashed.set(x, y);
+                mPending.push_back(PointU32{ static_cast<u32>(x), static_cast<u32>(y) });
+            }
+        };
+        for (auto y = uz{ 0 }; y < mEnergy.height(); ++y) {
+            for (auto x = uz{ 0 }; x < mEnergy.width(); ++x) {
+                raise(x, y);
+            }
+        }
+        static constexpr auto neighbors = std::array<PointI32, 8>{
+            { { -1, -1 }, { 0, -1 }, { 1, -1 }, { -1, 0 }, { 1, 0 }, { -1, 1 }, { 0, 1 }, { 1, 1 } }
+        };
+        while (!mPending.empty()) {
+            const auto octopus = mPending.back();
+            mPending.pop_back();
+            for (const auto& offset : neighbors) {
+                // wraps around to the padding at the border, which counts as flashed
+                raise(uz{ octopus.x } + static_cast<uz>(offset.x), uz{ octopus.y } + static_cast<uz>(offset.y));
+            }
+        }
+        mFlashed.forEachSet([&](const uz x, const uz y) { mEnergy(x, y) = 0; });
+        return mFlashed.count();
+    }
+
+    Cavern parse(const std::string_view input) {
+        AOC_TRACE_ZONE("day11::parse");
+        return Cavern::fromLines(splitLines(input));
+    }
+
+    uz part1(const Cavern& cavern) {
+        AOC_TRACE_ZONE("day11::part1");
+        auto simulated = cavern;
+        auto flashes = uz{ 0 };
+        for (auto i = 0; i < 100; ++i) {
+            flashes += simulated.step();
+        }
+        return flashes;
+    }
+
+    uz part2(const Cavern& cavern) {
+        AOC_TRACE_ZONE("day11::part2");
+        // the puzzle guarantees that the flashes synchronize, this only stops generated inputs that never do
+        constexpr auto maxSteps = uz{ 1'000'000 };
+        auto simulated = cavern;
+        for (auto step = uz{ 1 }; step <= maxSteps; ++step) {
+            if (simulated.step() == simulated.numOctopuses()) {
+                return step;
+            }
+        }
+        throw std::runtime_error{ "The octopuses never flash at the same time. " };
+    }
+}// namespace day11
+
+namespace {
+    const auto registration = PuzzleRegistration{ 11, "input.txt", day11::parse, day11::part1, day11::part2 };
+}
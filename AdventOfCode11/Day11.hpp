@@ -0,0 +1,38 @@
+#pragma once
+
+#include "AOCUtilities.hpp"
+#include "BitGrid.hpp"
+#include "Grid.hpp"
+#include <string_view>
+#include <vector>
+
+namespace day11 {
+    // energy levels of the octopuses, an octopus flashes when its level exceeds 9
+    class Cavern {
+    public:
+        static constexpr auto maxEnergy = u8{ 9 };
+
+        // the padding counts as flashed, so the flashes at the border never spread into it
+        Cavern(uz width, uz height) : mEnergy{ width, height, 0, 1 }, mFlashed{ width, height, true, 1 } { }
+
+        [[nodiscard]] static Cavern fromLines(const std::vector<std::string_view>& lines);
+
+        // raises every energy level by one, lets the octopuses flash and returns the number of flashes
+        uz step();
+
+        [[nodiscard]] uz numOctopuses() const {
+            return mEnergy.width() * mEnergy.height();
+        }
+
+    private:
+        Grid<u8> mEnergy;
+        BitGrid mFlashed;// the octopuses that flashed during the current step
+        std::vector<PointU32> mPending;// flashing octopuses whose neighbors are not raised yet
+    };
+
+    [[nodiscard]] Cavern parse(std::string_view input);
+    // flashes during the first 100 steps
+    [[nodiscard]] uz part1(const Cavern& cavern);
+    // the first step during which all octopuses flash
+    [[nodiscard]] uz part2(const Cavern& cavern);
+}// namespace day11
@@ -1,6 +1,6 @@
-#include "AOCUtilities.hpp"
-#include <iostream>
-
-int main() {
+#include "Day11.hpp"
+#include "PuzzleMain.hpp"
 
+int main(const int argc, char** const argv) {
+    return runPuzzleMain(11, argc, argv);
 }
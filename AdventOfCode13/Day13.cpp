@@ -0,0 +1,168 @@
+#include "Day13.hpp"
+#include "GridRenderer.hpp"
+#include "ParallelParse.hpp"
+#include "Puzzle.hpp"
+#include "SmallVector.hpp"
+#include "Trace.hpp"
+#include <algorithm>
+#include <array>
+#include <iterator>
+#include <ostream>
+#include <span>
+
+namespace day13 {
+    bool Paper::applyFold() {
+        AOC_TRACE_ZONE("day13::Paper::applyFold");
+        mDots = foldDots(mFolds.front());
+        mFolds.pop_front();
+        return !mFolds.empty();
+    }
+
+    Paper Paper::folded() const {
+        AOC_TRACE_ZONE("day13::Paper::folded");
+        auto result = Paper{};
+        result.mDots = foldDots(mFolds.front());
+        result.mFolds.assign(std::next(mFolds.begin()), mFolds.end());
+        return result;
+    }
+
+    BitGrid Paper::foldDots(const Fold& fold) const {
+        const auto line = uz{ fold.destination };
+        if (fold.type == FoldType::Horizontal) {
+            // the row 2 * line - y lands on the row y
+            auto foldedDots = BitGrid{ mDots.width(), line };
+            for (auto y = uz{ 0 }; y < line; ++y) {
+                const auto row = foldedDots.row(y);
+                std::ranges::copy(mDots.row(y), row.begin());
+                if (2 * line - y < mDots.height()) {
+                    orRow(row, mDots.row(2 * line - y));
+                }
+            }
+            return foldedDots;
+        }
+        // vertical fold, the columns right of the line are moved to the start of the row and mirrored
+        auto foldedDots = BitGrid{ line, mDots.height() };
+        // a row of the puzzle input fits into 21 words
+        auto mirrored = SmallVector<BitWord, 32>(mDots.wordsPerRow());
+        for (auto y = uz{ 0 }; y < mDots.height(); ++y) {
+            const auto row = foldedDots.row(y);
+            std::ranges::copy(mDots.row(y).first(row.size()), row.begin());
+            foldedDots.clearTail(row);
+            std::ranges::copy(mDots.row(y), mirrored.begin());
+            shiftRowDown(mirrored, line + 1);
+            reverseRow(mirrored, line);
+            orRow(row, std::span<const BitWord>{ mirrored }.first(row.size()));
+        }
+        return foldedDots;
+    }
+
+    std::string Paper::render() const {
+        AOC_TRACE_ZONE("day13::Paper::render");
+        auto renderer = GridRenderer{ mDots.width(), mDots.height() };
+        renderer.cells([&](const uz x, const uz y) { return mDots(x, y) ? std::string_view{ "■" } : " "; });
+        return renderer.text();
+    }
+
+    Paper Paper::fromText(const std::string_view text) {
+        AOC_TRACE_ZONE("day13::Paper::fromText");
+        // the dots, an empty line and the folds
+        auto blankLine = text.find("\n\n");
+        auto separatorLength = uz{ 2 };
+        if (const auto crlf = text.find("\n\r\n"); crlf < blankLine) {
+            blankLine = crlf;
+            separatorLength = 3;
+        }
+        const auto dotsText = text.substr(0, blankLine);
+        const auto foldsText = (blankLine == std::string_view::npos) ? std::string_view{}
+                                                                      : text.substr(blankLine + separatorLength);
+
+        const auto dots = parseChunked<PointType>(dotsText, [](const std::string_view chunk, auto& output) {
+            for (const auto line : splitLines(chunk)) {
+                std::array<u32, 2> coordinates{};
+                parseIntegers(line, std::span{ coordinates });
+                output.emplace_back(coordinates[0], coordinates[1]);
+            }
+        });
+        auto size = PointType{ 0, 0 };
+        for (const auto& dot : dots) {
+            size.x = std::max(size.x, dot.x + 1);
+            size.y = std::max(size.y, dot.y + 1);
+        }
+        auto result = Paper{};
+        result.markDots(dots, size);
+
+        using namespace std::string_view_literals;
+        static constexpr auto prefixLength = ("fold along "sv).length();
+        for (const auto line : splitLines(foldsText)) {
+            std::array<std::string_view, 2> parts;
+            splitInto(line.substr(prefixLength), parts, '=');
+            result.mFolds.emplace_back(parts[0] == "x" ? FoldType::Vertical : FoldType::Horizontal,
+                                       parseInteger<u32>(parts[1]));
+        }
+        return result;
+    }
+
+    void Paper::markDots(const std::span<const PointType> dots, const PointType size) {
+        mDots = BitGrid{ size.x, size.y };
+        for (const auto& dot : dots) {
+            mDots.set(dot);
+        }
+    }
+
+    void Paper::serialize(BinaryWriter& writer) const {
+        auto dots = std::vector<PointType>{};
+        mDots.forEachSet([&](const uz x, const uz y) { dots.emplace_back(static_cast<u32>(x), static_cast<u32>(y)); });
+        writer.writeSpan(std::span<const PointType>{ dots });
+        writer.write(PointType{ static_cast<u32>(mDots.width()), static_cast<u32>(mDots.height()) });
+        const auto folds = std::vector<Fold>(mFolds.begin(), mFolds.end());
+        writer.writeSpan(std::span{ folds });
+    }
+
+    Paper Paper::deserialize(BinaryReader& reader) {
+        auto result = Paper{};
+        const auto dots = reader.readVector<PointType>();
+        const auto size = reader.read<PointType>();
+        for (const auto& dot : dots) {
+            if (dot.x >= size.x || dot.y >= size.y) {
+                throw std::runtime_error{ "Dot outside of the paper. " };
+            }
+        }
+        result.markDots(dots, size);
+        const auto folds = reader.readVector<Fold>();
+        result.mFolds.assign(folds.begin(), folds.end());
+        return result;
+    }
+
+    std::ostream& operator<<(std::ostream& ostream, const Paper& paper) {
+        ostream << paper.render();
+        ostream << "\nFolds:\n";
+        for (const auto& fold : paper.mFolds) {
+            ostream << (fold.type == FoldType::Horizontal ? 'y' : 'x') << " = " << fold.destination << "\n";
+        }
+        return ostream;
+    }
+
+    Paper parse(const std::string_view input) {
+        AOC_TRACE_ZONE("day13::parse");
+        return Paper::fromText(input);
+    }
+
+    uz part1(const Paper& paper) {
+        AOC_TRACE_ZONE("day13::part1");
+        return paper.folded().numDots();
+    }
+
+    std::string part2(const Paper& paper) {
+        AOC_TRACE_ZONE("day13::part2");
+        auto folded = paper.folded();
+        while (folded.hasFolds()) {
+            folded.applyFold();
+        }
+        return folded.render();
+    }
+}// namespace day13
+
+namespace {
+    const auto registration = PuzzleRegistration{ 13, "input.txt", day13::parse, day13::part1, day13::part2,
+                                                  day13::parseCacheFormat };
+}
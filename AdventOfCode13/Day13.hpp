@@ -0,0 +1,74 @@
+#pragma once
+
+#include "AOCUtilities.hpp"
+#include "BitGrid.hpp"
+#include "ParseCache.hpp"
+#include <deque>
+#include <iosfwd>
+#include <span>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace day13 {
+    enum class FoldType {
+        Horizontal,
+        Vertical,
+    };
+
+    struct Fold {
+        FoldType type;
+        u32 destination;
+    };
+
+    class Paper {
+    public:
+        // applies the next fold and returns whether there are folds left
+        bool applyFold();
+
+        // a copy with the next fold applied, cheaper than copying and folding the unfolded dots
+        [[nodiscard]] Paper folded() const;
+
+        [[nodiscard]] bool hasFolds() const {
+            return !mFolds.empty();
+        }
+
+        [[nodiscard]] uz numDots() const {
+            return mDots.count();
+        }
+
+        // the dots as rows of "■" and " "
+        [[nodiscard]] std::string render() const;
+
+        // parses the dots on all threads for large inputs
+        [[nodiscard]] static Paper fromText(std::string_view text);
+
+        /* Parse cache payload: the dots as an array of PointU32 (row by row), the size as one PointU32 and the
+         * folds as an array of Fold (u32 type, u32 destination). */
+        void serialize(BinaryWriter& writer) const;
+        [[nodiscard]] static Paper deserialize(BinaryReader& reader);
+
+        friend std::ostream& operator<<(std::ostream& ostream, const Paper& paper);
+
+    private:
+        using PointType = PointU32;
+
+        // the size of the paper is that of the dots
+        void markDots(std::span<const PointType> dots, PointType size);
+
+        [[nodiscard]] BitGrid foldDots(const Fold& fold) const;
+
+    private:
+        BitGrid mDots;
+        std::deque<Fold> mFolds;
+    };
+
+    [[nodiscard]] Paper parse(std::string_view input);
+    inline constexpr auto parseCacheFormat = ParseCacheFormat<Paper>{
+        1, [](const Paper& paper, BinaryWriter& writer) { paper.serialize(writer); }, Paper::deserialize
+    };
+    // number of dots after the first fold
+    [[nodiscard]] uz part1(const Paper& paper);
+    // the code that is visible after all folds
+    [[nodiscard]] std::string part2(const Paper& paper);
+}// namespace day13
@@ -0,0 +1,129 @@
+#include "Day14.hpp"
+#include "Arena.hpp"
+#include "Puzzle.hpp"
+#include "Trace.hpp"
+#include <algorithm>
+#include <memory_resource>
+#include <queue>
+#include <vector>
+#include <cassert>
+
+namespace day14 {
+    namespace {
+        struct Insertion {
+            char character;
+            uz position;
+
+            [[nodiscard]] bool operator>(const Insertion& other) const {
+                return position > other.position;
+            }
+        };
+
+        [[nodiscard]] uz differenceOfMostAndLeastCommon(const std::unordered_map<char, uz>& counts) {
+            const auto max = std::max_element(counts.begin(), counts.end(),
+                                              [](const auto& lhs, const auto& rhs) { return lhs.second < rhs.second; });
+            assert(max != counts.end());
+            const auto min = std::min_element(counts.begin(), counts.end(),
+                                              [](const auto& lhs, const auto& rhs) { return lhs.second < rhs.second; });
+            assert(min != counts.end());
+            return max->second - min->second;
+        }
+
+        template<typename Map, typename Key, typename Value>
+        void addOrCreate(Map& map, Key key, Value value) {
+            map[key] = (map.contains(key) ? map[key] + value : value);
+        }
+
+        [[nodiscard]] auto pairCountsFromString(const std::string_view string,
+                                                std::pmr::memory_resource* const resource) {
+            auto pairCounts = std::pmr::unordered_map<CharPair, uz>{ resource };
+            for (auto i = uz{ 0 }; i < string.length() - 1; ++i) {
+                addOrCreate(pairCounts, CharPair{ string.at(i), string.at(i + 1) }, 1);
+            }
+            return pairCounts;
+        }
+    }// namespace
+
+    Manual parse(const std::string_view input) {
+        AOC_TRACE_ZONE("day14::parse");
+        const auto lines = splitLines(input);
+        auto manual = Manual{ .polymerTemplate = std::string{ lines.front() } };
+        for (auto i = uz{ 2 }; i < lines.size(); ++i) {
+            manual.pairInsertionRules[{ lines[i][0], lines[i][1] }] = lines[i].at(6);
+        }
+        return manual;
+    }
+
+    uz part1(const Manual& manual) {
+        AOC_TRACE_ZONE("day14::part1");
+        auto polymerTemplate = manual.polymerTemplate;
+        constexpr auto numSteps = 10;
+        for (int step = 0; step < numSteps; ++step) {
+            AOC_TRACE_ZONE("day14::step");
+            std::priority_queue<Insertion, std::vector<Insertion>, std::greater<>> insertions;
+            for (auto i = uz{ 0 }; i < polymerTemplate.length(); ++i) {
+                const auto findIterator = manual.pairInsertionRules.find({ polymerTemplate[i], polymerTemplate[i + 1] });
+                if (findIterator != manual.pairInsertionRules.end()) {
+                    insertions.emplace(findIterator->second, i + 1);
+                }
+            }
+
+            auto offset = uz{ 0 };
+            while (!insertions.empty()) {
+                const auto& insertion = insertions.top();
+                polymerTemplate.insert(insertion.position + offset, 1, insertion.character);
+                ++offset;
+                insertions.pop();
+            }
+        }
+
+        std::unordered_map<char, uz> counts;
+        for (const auto c : polymerTemplate) {
+            addOrCreate(counts, c, 1);
+        }
+        return differenceOfMostAndLeastCommon(counts);
+    }
+
+    uz part2(const Manual& manual) {
+        AOC_TRACE_ZONE("day14::part2");
+        const auto& pairInsertionRules = manual.pairInsertionRules;
+        // every step erases and inserts the pairs again, the pool hands the freed nodes out again
+        auto pool = std::pmr::unsynchronized_pool_resource{};
+        auto pairCounts = pairCountsFromString(manual.polymerTemplate, &pool);
+        constexpr auto numSteps = 40;
+        auto arena = Arena{};
+        for (auto i = 0; i < numSteps; ++i) {
+            AOC_TRACE_ZONE("day14::step");
+            arena.reset();
+            auto newPairInsertions =
+                    std::pmr::unordered_map<CharPair, uz>{ pairInsertionRules.size(), arena.resource() };
+            for (const auto& insertionRule : pairInsertionRules) {
+                const auto findIterator = pairCounts.find(insertionRule.first);
+                if (findIterator == pairCounts.end()) {
+                    continue;
+                }
+                const auto newPairs = std::array{ CharPair{ findIterator->first.chars[0], insertionRule.second },
+                                                  CharPair{ insertionRule.second, findIterator->first.chars[1] } };
+                for (const auto& pair : newPairs) {
+                    addOrCreate(newPairInsertions, pair, findIterator->second);
+                }
+                pairCounts.erase(findIterator);
+            }
+            for (const auto& insertion : newPairInsertions) {
+                addOrCreate(pairCounts, insertion.first, insertion.second);
+            }
+        }
+        auto counts = std::unordered_map<char, uz>{};
+        for (const auto& pairCount : pairCounts) {
+            for (const auto c : pairCount.first.chars) {
+                addOrCreate(counts, c, pairCount.second);
+            }
+        }
+        std::for_each(counts.begin(), counts.end(), [](auto& count) { count.second = (count.second + 1) / 2; });
+        return differenceOfMostAndLeastCommon(counts);
+    }
+}// namespace day14
+
+namespace {
+    const auto registration = PuzzleRegistration{ 14, "input.txt", day14::parse, day14::part1, day14::part2 };
+}
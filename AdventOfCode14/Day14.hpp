@@ -0,0 +1,38 @@
+#pragma once
+
+#include "AOCUtilities.hpp"
+#include <array>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+
+namespace day14 {
+    struct CharPair {
+        std::array<char, 2> chars;
+
+        [[nodiscard]] bool operator==(const CharPair&) const = default;
+    };
+
+    // both characters in one word (the previous hash shifted by sizeof(char), i.e. a single bit)
+    [[nodiscard]] constexpr std::array<u64, 1> hashWords(const CharPair& charPair) {
+        return { (static_cast<u64>(static_cast<u8>(charPair.chars[0])) << 8) | static_cast<u8>(charPair.chars[1]) };
+    }
+}// namespace day14
+
+namespace std {
+    template<>
+    struct hash<day14::CharPair> : Murmur3Hasher<day14::CharPair> { };
+}// namespace std
+
+namespace day14 {
+    struct Manual {
+        std::string polymerTemplate;
+        std::unordered_map<CharPair, char> pairInsertionRules;
+    };
+
+    [[nodiscard]] Manual parse(std::string_view input);
+    // difference between the most and least common element after 10 steps
+    [[nodiscard]] uz part1(const Manual& manual);
+    // difference between the most and least common element after 40 steps
+    [[nodiscard]] uz part2(const Manual& manual);
+}// namespace day14
@@ -0,0 +1,127 @@
+#include "Day15.hpp"
+#include "GridRenderer.hpp"
+#include "Puzzle.hpp"
+#include "Trace.hpp"
+#include <algorithm>
+#include <array>
+#include <functional>
+#include <limits>
+#include <ostream>
+#include <queue>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+#include <cassert>
+
+namespace day15 {
+    Map Map::fromLines(const std::vector<std::string_view>& lines) {
+        AOC_TRACE_ZONE("day15::Map::fromLines");
+        auto result = Map{ lines.front().length(), lines.size() };
+        for (auto y = uz{ 0 }; y < lines.size(); ++y) {
+            const auto line = lines[y];
+            const auto row = result.mTiles.row(y);
+            for (auto x = uz{ 0 }; x < line.length(); ++x) {
+                row[x] = static_cast<u8>(line[x] - '0');
+            }
+        }
+        return result;
+    }
+
+    Map Map::expanded(const uz scalingFactor) const {
+        AOC_TRACE_ZONE("day15::Map::expanded");
+        const auto subMapWidth = width();
+        const auto subMapHeight = height();
+        auto result = Map{ subMapWidth * scalingFactor, subMapHeight * scalingFactor };
+        for (auto y = uz{ 0 }; y < subMapHeight; ++y) {
+            std::ranges::copy(mTiles.row(y), result.mTiles.row(y).begin());
+        }
+
+        for (auto i = uz{ 0 }; i < scalingFactor; ++i) {
+            for (auto j = uz{ 0 }; j < scalingFactor; ++j) {
+                if (i == 0 && j == 0) {
+                    continue;
+                }
+                for (auto y = uz{ 0 }; y < subMapHeight; ++y) {
+                    for (auto x = uz{ 0 }; x < subMapWidth; ++x) {
+                        assert(i + j < 9);// :)
+                        auto newValue = (result.mTiles(x, y) + i + j);
+                        if (newValue > 9) {
+                            newValue %= 9;
+                        }
+                        result.mTiles(x + subMapWidth * i, y + subMapHeight * j) = static_cast<u8>(newValue);
+                    }
+                }
+            }
+        }
+        return result;
+    }
+
+    uz Map::calculateMinCost() const {
+        AOC_TRACE_ZONE("day15::Map::calculateMinCost");
+        // Dijkstra on the indices of the cells, entries of the queue that have been improved on are skipped
+        constexpr auto unreached = std::numeric_limits<u32>::max();
+        auto costs = Grid<u32>{ width(), height(), unreached, 1 };
+        const auto neighborOffsets = std::array{
+                uz{ 1 },                   // right
+                uz{ 0 } - 1,               // left
+                uz{ 0 } - mTiles.stride(), // up
+                mTiles.stride(),           // down
+        };
+        using Candidate = std::pair<u32, uz>;// cost, index
+        auto toVisit = std::priority_queue<Candidate, std::vector<Candidate>, std::greater<>>{};
+        const auto start = mTiles.indexOf(uz{ 0 }, uz{ 0 });
+        const auto destination = mTiles.indexOf(width() - 1, height() - 1);
+        costs[start] = 0;
+        toVisit.emplace(0, start);
+        while (!toVisit.empty()) {
+            const auto [cost, index] = toVisit.top();
+            toVisit.pop();
+            if (index == destination) {
+                return cost;
+            }
+            if (cost > costs[index]) {
+                continue;
+            }
+            for (const auto offset : neighborOffsets) {
+                const auto neighbor = index + offset;
+                // the padding stops the search at the border
+                if (mTiles[neighbor] == outside) {
+                    continue;
+                }
+                const auto newCost = cost + mTiles[neighbor];
+                if (newCost < costs[neighbor]) {
+                    costs[neighbor] = newCost;
+                    toVisit.emplace(newCost, neighbor);
+                }
+            }
+        }
+        throw std::runtime_error{ "The destination cannot be reached. " };
+    }
+
+    std::ostream& operator<<(std::ostream& ostream, const Map& map) {
+        GridRenderer{ map.width(), map.height() }
+                .cells([&](const uz x, const uz y) { return static_cast<char>('0' + map.at(x, y)); })
+                .write(ostream);
+        return ostream;
+    }
+
+    Map parse(const std::string_view input) {
+        AOC_TRACE_ZONE("day15::parse");
+        return Map::fromLines(splitLines(input));
+    }
+
+    uz part1(const Map& map) {
+        AOC_TRACE_ZONE("day15::part1");
+        return map.calculateMinCost();
+    }
+
+    uz part2(const Map& map) {
+        AOC_TRACE_ZONE("day15::part2");
+        static constexpr auto scalingFactor = uz{ 5 };
+        return map.expanded(scalingFactor).calculateMinCost();
+    }
+}// namespace day15
+
+namespace {
+    const auto registration = PuzzleRegistration{ 15, "input.txt", day15::parse, day15::part1, day15::part2 };
+}
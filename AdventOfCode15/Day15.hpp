@@ -0,0 +1,49 @@
+#pragma once
+
+#include "AOCUtilities.hpp"
+#include "Grid.hpp"
+#include <iosfwd>
+#include <string_view>
+#include <vector>
+
+namespace day15 {
+    class Map {
+    public:
+        // risk levels are 1 to 9, the padding around the map is marked with 0
+        static constexpr auto outside = u8{ 0 };
+
+        Map(uz width, uz height) : mTiles{ width, height, outside, 1 } { }
+
+        [[nodiscard]] static Map fromLines(const std::vector<std::string_view>& lines);
+
+        // the full map of part 2 that repeats this map with increasing risk levels
+        [[nodiscard]] Map expanded(uz scalingFactor) const;
+
+        [[nodiscard]] uz calculateMinCost() const;
+
+        u8& at(uz x, uz y) {
+            return mTiles.at(x, y);
+        }
+
+        [[nodiscard]] u8 at(uz x, uz y) const {
+            return mTiles.at(x, y);
+        }
+
+        [[nodiscard]] uz width() const {
+            return mTiles.width();
+        }
+
+        [[nodiscard]] uz height() const {
+            return mTiles.height();
+        }
+
+    private:
+        Grid<u8> mTiles;
+    };
+
+    std::ostream& operator<<(std::ostream& ostream, const Map& map);
+
+    [[nodiscard]] Map parse(std::string_view input);
+    [[nodiscard]] uz part1(const Map& map);
+    [[nodiscard]] uz part2(const Map& map);
+}// namespace day15
@@ -0,0 +1,51 @@
+#pragma once
+
+#include "AOCUtilities.hpp"
+#include "expected.hpp"
+#include <memory>
+#include <string>
+#include <string_view>
+#include <variant>
+#include <vector>
+
+namespace day16 {
+    struct LiteralPacket {
+        u64 version;
+        u64 type{ 4 };
+        u64 value;
+    };
+
+    struct ResultDescription;
+
+    struct OperatorPacket {
+        u64 version;
+        u64 type;
+        std::vector<ResultDescription> subPacketsInfo;
+    };
+
+    struct ResultDescription {
+        std::variant<std::string_view, u64, LiteralPacket, OperatorPacket, std::vector<ResultDescription>> consumed;
+        std::string_view remainder;
+    };
+
+    using Input = std::string_view;
+    using ParseResult = tl::expected<ResultDescription, std::string_view>;
+    using ParseError = tl::unexpected<std::string_view>;
+
+    struct Transmission {
+        // the binary representation, on the heap to keep the views of the parse result valid when moving
+        std::unique_ptr<const std::string> binary;
+        ParseResult packet;
+    };
+
+    [[nodiscard]] std::string decode(std::string_view input);
+
+    [[nodiscard]] Transmission parse(std::string_view input);
+    // sum of all version numbers
+    [[nodiscard]] u64 part1(const Transmission& transmission);
+    // value of the outermost packet
+    [[nodiscard]] u64 part2(const Transmission& transmission);
+
+    void runTestcases();
+    void runTestcasesPart2();
+}// namespace day16
@@ -0,0 +1,41 @@
+#include "Day17.hpp"
+#include "Day17Input.hpp"
+#include "Puzzle.hpp"
+#include "ThreadPool.hpp"
+#include "Trace.hpp"
+
+namespace day17 {
+    TargetArea parse(const std::string_view input) {
+        AOC_TRACE_ZONE("day17::parse");
+        // testcase: "target area: x=20..30, y=-10..-5"
+        return parseTargetArea(input);
+    }
+
+    Trajectories simulate(const TargetArea& target) {
+        AOC_TRACE_ZONE("day17::simulate");
+        const auto minX = minVelocityX(target);
+        return parallelReduce(
+                uz{ 0 }, static_cast<uz>(target.maxX - minX + 1), Trajectories{ 0, 0 },
+                [&](const uz i) { return simulateVelocityX(target, minX + static_cast<int>(i)); }, merge);
+    }
+
+    int part1(const TargetArea& target) {
+        AOC_TRACE_ZONE("day17::part1");
+        return simulate(target).highest;
+    }
+
+    int part2(const TargetArea& target) {
+        AOC_TRACE_ZONE("day17::part2");
+        return simulate(target).count;
+    }
+}// namespace day17
+
+namespace {
+    // the embedded input.txt solved by the compiler, a changed input fails the build until the answers are updated
+    constexpr auto embeddedTrajectories =
+            day17::simulateSequentially(day17::parseTargetArea(day17::embedded::input));
+    static_assert(embeddedTrajectories.highest == 8646);
+    static_assert(embeddedTrajectories.count == 5945);
+
+    const auto registration = PuzzleRegistration{ 17, "input.txt", day17::parse, day17::part1, day17::part2 };
+}
@@ -0,0 +1,87 @@
+#pragma once
+
+#include "AOCUtilities.hpp"
+#include <algorithm>
+#include <array>
+#include <span>
+#include <string_view>
+
+namespace day17 {
+    struct TargetArea {
+        int minX;
+        int maxX;
+        int minY;
+        int maxY;
+    };
+
+    struct Trajectories {
+        int highest;
+        int count;
+    };
+
+    // the bounds of "target area: x=155..215, y=-132..-72"
+    [[nodiscard]] constexpr TargetArea parseTargetArea(const std::string_view input) {
+        auto bounds = std::array<int, 4>{};
+        if (parseIntegers(input, std::span{ bounds }) != bounds.size()) {
+            throw std::runtime_error{ "Expected four bounds. " };
+        }
+        return TargetArea{ bounds[0], bounds[1], bounds[2], bounds[3] };
+    }
+
+    // the smallest starting velocity x that gets as far as the target area, x stops after v (v + 1) / 2
+    [[nodiscard]] constexpr int minVelocityX(const TargetArea& target) {
+        auto velocity = 0;
+        while (velocity * (velocity + 1) / 2 < target.minX) {
+            ++velocity;
+        }
+        return velocity;
+    }
+
+    // the trajectories with one starting velocity x, which are independent of those of all other velocities
+    [[nodiscard]] constexpr Trajectories simulateVelocityX(const TargetArea& target, const int startingVelocityX) {
+        const auto maxVelocityY = -target.minY;
+        const auto minVelocityY = target.minY;
+        auto result = Trajectories{ 0, 0 };
+        for (auto startingVelocityY = minVelocityY; startingVelocityY <= maxVelocityY; ++startingVelocityY) {
+            // simulate
+            auto position = Point<int>{ 0, 0 };
+            auto step = Point<int>{ startingVelocityX, startingVelocityY };
+            auto currentHighest = 0;
+            while (position.y >= target.minY) {
+                position += step;
+                currentHighest = std::max(currentHighest, position.y);
+                if (position.x >= target.minX && position.x <= target.maxX && position.y >= target.minY &&
+                    position.y <= target.maxY) {
+                    result.highest = std::max(result.highest, currentHighest);
+                    ++result.count;
+                    break;
+                }
+                step = { std::max(step.x - 1, 0), step.y - 1 };
+                // past the area or stopped in front of it, the probe can only fall from here on
+                if (position.x > target.maxX || (step.x == 0 && position.x < target.minX)) {
+                    break;
+                }
+            }
+        }
+        return result;
+    }
+
+    [[nodiscard]] constexpr Trajectories merge(const Trajectories& lhs, const Trajectories& rhs) {
+        return Trajectories{ std::max(lhs.highest, rhs.highest), lhs.count + rhs.count };
+    }
+
+    // simulate() on a single thread, which is what constant expressions can do
+    [[nodiscard]] constexpr Trajectories simulateSequentially(const TargetArea& target) {
+        auto result = Trajectories{ 0, 0 };
+        for (auto velocityX = minVelocityX(target); velocityX <= target.maxX; ++velocityX) {
+            result = merge(result, simulateVelocityX(target, velocityX));
+        }
+        return result;
+    }
+
+    [[nodiscard]] TargetArea parse(std::string_view input);
+    // highest y position of all trajectories that hit the target area and their number
+    [[nodiscard]] Trajectories simulate(const TargetArea& target);
+    [[nodiscard]] int part1(const TargetArea& target);
+    [[nodiscard]] int part2(const TargetArea& target);
+}// namespace day17
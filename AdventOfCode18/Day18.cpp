@@ -0,0 +1,266 @@
+#include "Day18.hpp"
+#include "Puzzle.hpp"
+#include "ThreadPool.hpp"
+#include "Trace.hpp"
+#include <algorithm>
+#include <array>
+#include <optional>
+#include <ostream>
+#include <stack>
+#include <cassert>
+#include <cctype>
+
+namespace day18 {
+    SnailfishNumber SnailfishNumber::operator+(const SnailfishNumber& other) const {
+        AOC_TRACE_ZONE("day18::SnailfishNumber::operator+");
+        auto lhs = *this;
+        auto rhs = other;
+        for (auto& token : lhs.tokens) {
+            auto openBracketPtr = std::dynamic_pointer_cast<OpeningBracket>(token);
+            if (openBracketPtr) {
+                ++(openBracketPtr->level);
+                continue;
+            }
+            auto closingBracketPtr = std::dynamic_pointer_cast<ClosingBracket>(token);
+            if (closingBracketPtr) {
+                ++(closingBracketPtr->level);
+            }
+        }
+        for (auto& token : rhs.tokens) {
+            auto openBracketPtr = std::dynamic_pointer_cast<OpeningBracket>(token);
+            if (openBracketPtr) {
+                ++(openBracketPtr->level);
+                continue;
+            }
+            auto closingBracketPtr = std::dynamic_pointer_cast<ClosingBracket>(token);
+            if (closingBracketPtr) {
+                ++(closingBracketPtr->level);
+            }
+        }
+        auto result = SnailfishNumber{};
+        result.tokens.push_back(std::make_shared<OpeningBracket>(0));
+        for (const auto& token : lhs.tokens) {
+            result.tokens.push_back(token);
+        }
+        result.tokens.push_back(std::make_shared<Comma>());
+        for (const auto& token : rhs.tokens) {
+            result.tokens.push_back(token);
+        }
+        result.tokens.push_back(std::make_shared<ClosingBracket>(0));
+        result.reduce();
+        return result;
+    }
+
+    SnailfishNumber SnailfishNumber::clone() const {
+        auto result = SnailfishNumber{};
+        result.tokens.reserve(tokens.size());
+        for (const auto& token : tokens) {
+            if (const auto openingBracketPtr = std::dynamic_pointer_cast<OpeningBracket>(token)) {
+                result.tokens.push_back(std::make_shared<OpeningBracket>(*openingBracketPtr));
+            } else if (const auto closingBracketPtr = std::dynamic_pointer_cast<ClosingBracket>(token)) {
+                result.tokens.push_back(std::make_shared<ClosingBracket>(*closingBracketPtr));
+            } else if (const auto regularNumberPtr = std::dynamic_pointer_cast<RegularNumber>(token)) {
+                result.tokens.push_back(std::make_shared<RegularNumber>(*regularNumberPtr));
+            } else {
+                result.tokens.push_back(std::make_shared<Comma>());
+            }
+        }
+        return result;
+    }
+
+    void SnailfishNumber::explode(const TokenList::iterator openingBracketIterator) {
+        AOC_TRACE_ZONE("day18::SnailfishNumber::explode");
+        /* Iterator points to the opening bracket of the pair to explode
+         * ... [ L , R ] ...
+         * ... 0 1 2 3 4 ... <- relative offsets to iterator
+         */
+        const auto pair =
+                std::array{ std::static_pointer_cast<RegularNumber>(*std::next(openingBracketIterator, 1))->value,
+                            std::static_pointer_cast<RegularNumber>(*std::next(openingBracketIterator, 3))->value };
+        // find first regular number to the left
+        for (auto iterator = std::next(openingBracketIterator, -1); iterator > std::begin(tokens); --iterator) {
+            const auto regularNumberPtr = std::dynamic_pointer_cast<RegularNumber>(*iterator);
+            if (regularNumberPtr) {
+                // add left pair value to this regular number
+                regularNumberPtr->value += pair.at(0);
+                break;
+            }
+        }
+
+        // find first regular number to the right of the pair
+        for (auto iterator = std::next(openingBracketIterator, 5); iterator < std::end(tokens); ++iterator) {
+            const auto regularNumberPtr = std::dynamic_pointer_cast<RegularNumber>(*iterator);
+            if (regularNumberPtr) {
+                // add right pair value to this regular number
+                regularNumberPtr->value += pair.at(1);
+                break;
+            }
+        }
+
+        // replace exploded pair with 0
+        // first erase everything of the pair except the opening bracket
+        tokens.erase(std::next(openingBracketIterator, 1), std::next(openingBracketIterator, 5));
+        // then replace the opening bracket with the regular number 0
+        *openingBracketIterator = std::make_shared<RegularNumber>(0);
+    }
+
+    void SnailfishNumber::split(const TokenList::iterator numberIterator) {
+        AOC_TRACE_ZONE("day18::SnailfishNumber::split");
+        // calculate the contents of the pair to be created
+        const auto pair = std::array{ std::static_pointer_cast<RegularNumber>(*numberIterator)->value / 2,
+                                      (std::static_pointer_cast<RegularNumber>(*numberIterator)->value + 1) / 2 };
+
+        // find closest bracket to determine nesting-level
+        const int surroundingLevel = [&]() {
+            const auto leftNeighborPtr = std::dynamic_pointer_cast<OpeningBracket>(*std::next(numberIterator, -1));
+            if (leftNeighborPtr) {
+                return leftNeighborPtr->level;
+            }
+            return std::static_pointer_cast<OpeningBracket>(*std::next(numberIterator))->level;
+        }();
+
+        // replace the number with an opening bracket
+        *numberIterator = std::make_shared<OpeningBracket>(surroundingLevel + 1);
+        // get position inside the container (because iterators are going to be invalidated while inserting)
+        // and then insert the rest of the pair
+        const auto numberPosition = std::distance(std::begin(tokens), numberIterator);
+        tokens.insert(std::next(std::begin(tokens), numberPosition + 1), std::make_shared<RegularNumber>(pair.at(0)));
+        tokens.insert(std::next(std::begin(tokens), numberPosition + 2), std::make_shared<Comma>());
+        tokens.insert(std::next(std::begin(tokens), numberPosition + 3), std::make_shared<RegularNumber>(pair.at(1)));
+        tokens.insert(std::next(std::begin(tokens), numberPosition + 4),
+                      std::make_shared<ClosingBracket>(surroundingLevel + 1));
+    }
+
+    void SnailfishNumber::reduce() {
+        AOC_TRACE_ZONE("day18::SnailfishNumber::reduce");
+        bool canBeReducedFurther = true;
+        while (canBeReducedFurther) {
+            // check for level-4-nesting
+            const auto deeplyNestedIterator = std::find_if(std::begin(tokens), std::end(tokens), [](const auto& token) {
+                const auto openingBracketPtr = std::dynamic_pointer_cast<OpeningBracket>(token);
+                return openingBracketPtr && openingBracketPtr->level >= 4;
+            });
+            if (deeplyNestedIterator != std::end(tokens)) {
+                explode(deeplyNestedIterator);
+                continue;
+            }
+            const auto highRegularNumberIterator =
+                    std::find_if(std::begin(tokens), std::end(tokens), [](const auto& token) {
+                        const auto regularNumberPtr = std::dynamic_pointer_cast<RegularNumber>(token);
+                        return regularNumberPtr && regularNumberPtr->value >= 10;
+                    });
+            if (highRegularNumberIterator != std::end(tokens)) {
+                split(highRegularNumberIterator);
+                continue;
+            }
+            canBeReducedFurther = false;
+        }
+    }
+
+    int SnailfishNumber::magnitude() const {
+        AOC_TRACE_ZONE("day18::SnailfishNumber::magnitude");
+        auto stack = std::stack<int>{};
+        for (const auto& token : tokens) {
+            const auto numberPtr = std::dynamic_pointer_cast<RegularNumber>(token);
+            if (numberPtr) {
+                stack.push(numberPtr->value);
+                continue;
+            }
+            const auto closingBracketPtr = std::dynamic_pointer_cast<ClosingBracket>(token);
+            if (closingBracketPtr) {
+                const auto rhs = stack.top();
+                stack.pop();
+                const auto lhs = stack.top();
+                stack.pop();
+                stack.push(3 * lhs + 2 * rhs);
+            }
+        }
+        assert(stack.size() == 1);
+        return stack.top();
+    }
+
+    SnailfishNumber parseSnailfishNumber(const std::string_view input) {
+        AOC_TRACE_ZONE("day18::parseSnailfishNumber");
+        int level = -1;
+        auto result = SnailfishNumber{};
+        const auto last = input.data() + input.size();
+        for (auto current = input.data(); current != last; ++current) {
+            const auto c = *current;
+            if (std::isdigit(c)) {
+                auto value = 0;
+                current = parseIntegerPrefix(current, last, value) - 1;
+                result.tokens.push_back(std::make_shared<RegularNumber>(value));
+                continue;
+            }
+
+            if (c == '[') {
+                ++level;
+                result.tokens.push_back(std::make_shared<OpeningBracket>(level));
+            } else if (c == ']') {
+                result.tokens.push_back(std::make_shared<ClosingBracket>(level));
+                --level;
+            } else if (c == ',') {
+                result.tokens.push_back(std::make_shared<Comma>());
+            }
+        }
+        return result;
+    }
+
+    std::ostream& operator<<(std::ostream& ostream, const SnailfishNumber& number) {
+        for (const auto& token : number.tokens) {
+            ostream << token->stringRepresentation();
+        }
+        return ostream;
+    }
+
+    Homework parse(const std::string_view input) {
+        AOC_TRACE_ZONE("day18::parse");
+        auto result = Homework{};
+        for (const auto line : splitLines(input)) {
+            result.push_back(parseSnailfishNumber(line));
+        }
+        return result;
+    }
+
+    SnailfishNumber sum(const Homework& numbers) {
+        // the numbers are cloned since adding them changes their tokens
+        auto result = numbers.front().clone();
+        for (auto iterator = std::next(numbers.begin()); iterator < std::end(numbers); ++iterator) {
+            result = result + iterator->clone();
+        }
+        return result;
+    }
+
+    int part1(const Homework& numbers) {
+        AOC_TRACE_ZONE("day18::part1");
+        return sum(numbers).magnitude();
+    }
+
+    int part2(const Homework& numbers) {
+        AOC_TRACE_ZONE("day18::part2");
+        // every pair is added on its own clones, so the rows of the all-pairs search run in parallel
+        const auto max = parallelReduce(
+                uz{ 0 }, numbers.size(), std::optional<int>{},
+                [&numbers](const uz i) {
+                    auto rowMax = std::optional<int>{};
+                    for (auto j = uz{ 0 }; j < numbers.size(); ++j) {
+                        if (i == j) {
+                            continue;
+                        }
+                        const auto magnitude = (numbers[i].clone() + numbers[j].clone()).magnitude();
+                        if (!rowMax || magnitude > rowMax.value()) {
+                            rowMax = magnitude;
+                        }
+                    }
+                    return rowMax;
+                },
+                // an empty optional compares less than any magnitude
+                [](const std::optional<int>& lhs, const std::optional<int>& rhs) { return std::max(lhs, rhs); });
+        assert(max);
+        return max.value();
+    }
+}// namespace day18
+
+namespace {
+    const auto registration = PuzzleRegistration{ 18, "input.txt", day18::parse, day18::part1, day18::part2 };
+}
@@ -0,0 +1,86 @@
+#pragma once
+
+#include "AOCUtilities.hpp"
+#include <iosfwd>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace day18 {
+    struct Token {
+        [[nodiscard]] virtual std::string stringRepresentation() const = 0;
+    };
+
+    struct Bracket : public Token {
+        explicit Bracket(int level) : level{ level } { }
+
+        int level;
+    };
+
+    struct OpeningBracket : public Bracket {
+        using Bracket::Bracket;
+
+        [[nodiscard]] std::string stringRepresentation() const override {
+            return "[";
+            // return "[\n" + std::string(static_cast<uz>(level + 1), '\t');
+        }
+    };
+
+    struct ClosingBracket : public Bracket {
+        using Bracket::Bracket;
+
+        [[nodiscard]] std::string stringRepresentation() const override {
+            return "]";
+            //return "\n" + std::string(static_cast<uz>(level), '\t') + "]";
+        }
+    };
+
+    struct RegularNumber : public Token {
+        explicit RegularNumber(int value) : value{ value } { }
+
+        [[nodiscard]] std::string stringRepresentation() const override {
+            return std::to_string(value);
+        }
+
+        int value;
+    };
+
+    struct Comma : public Token {
+        [[nodiscard]] std::string stringRepresentation() const override {
+            return ",";
+        }
+    };
+
+    using TokenList = std::vector<std::shared_ptr<Token>>;
+
+    struct SnailfishNumber {
+        // Warning: This struct DOES NOT implement a proper copy constructor!
+        // copying instances of this type and changing the contents does also change the
+        // copied-from object (due to the shared_ptr), use clone() for a deep copy
+
+        [[nodiscard]] SnailfishNumber operator+(const SnailfishNumber& other) const;
+        [[nodiscard]] SnailfishNumber clone() const;
+
+        void explode(TokenList::iterator openingBracketIterator);
+        void split(TokenList::iterator numberIterator);
+        void reduce();
+        [[nodiscard]] int magnitude() const;
+
+        TokenList tokens;
+    };
+
+    [[nodiscard]] SnailfishNumber parseSnailfishNumber(std::string_view input);
+
+    std::ostream& operator<<(std::ostream& ostream, const SnailfishNumber& number);
+
+    using Homework = std::vector<SnailfishNumber>;
+
+    [[nodiscard]] Homework parse(std::string_view input);
+    // sum of all numbers
+    [[nodiscard]] SnailfishNumber sum(const Homework& numbers);
+    // magnitude of the sum of all numbers
+    [[nodiscard]] int part1(const Homework& numbers);
+    // largest magnitude of the sum of any two different numbers
+    [[nodiscard]] int part2(const Homework& numbers);
+}// namespace day18
@@ -0,0 +1,126 @@
+#include "Day19.hpp"
+#include "Arena.hpp"
+#include "ParallelParse.hpp"
+#include "Puzzle.hpp"
+#include "ThreadPool.hpp"
+#include "Trace.hpp"
+#include <algorithm>
+#include <array>
+#include <functional>
+#include <iostream>
+#include <memory_resource>
+#include <numeric>
+#include <span>
+#include <unordered_map>
+#include <cmath>
+
+namespace day19 {
+    namespace {
+        [[maybe_unused]] void printMeasurements(const Measurements& measurements) {
+            for (auto i = uz{}; i < measurements.size(); ++i) {
+                std::cout << "Scanner " << i << "\n";
+                for (const auto& point : measurements.at(i)) {
+                    std::cout << "\t(" << point.x << "," << point.y << "," << point.z << ")\n";
+                }
+            }
+        }
+
+        [[nodiscard]] i64 manhattanDistance(const Point3D<i64>& lhs, const Point3D<i64>& rhs) {
+            return std::abs(lhs.x - rhs.x) + std::abs(lhs.y - rhs.y) + std::abs(lhs.z - rhs.z);
+        }
+    }// namespace
+
+    Measurements parse(const std::string_view input) {
+        AOC_TRACE_ZONE("day19::parse");
+        using namespace std::string_view_literals;
+        constexpr auto scannerPrefix = "--- scanner "sv;
+        // the chunks end at the empty lines between the scanners, so every scanner is parsed as a whole
+        auto measurements = parseChunked<std::vector<Point3D<i64>>>(
+                input,
+                [&](const std::string_view chunk, auto& scanners) {
+                    for (const auto line : splitLines(chunk)) {
+                        if (line.starts_with(scannerPrefix)) {
+                            scanners.emplace_back();
+                            continue;
+                        }
+                        if (line.empty()) {
+                            continue;
+                        }
+                        std::array<i64, 3> coordinates{};
+                        parseIntegers(line, std::span{ coordinates });
+                        scanners.back().emplace_back(coordinates[0], coordinates[1], coordinates[2]);
+                    }
+                },
+                "\n\n");
+        // printMeasurements(measurements);
+        return measurements;
+    }
+
+    uz part1(const Measurements& measurements) {
+        AOC_TRACE_ZONE("day19::part1");
+        auto numInputBeacons = uz{};
+        auto distances = std::vector<std::vector<std::vector<i64>>>{};
+        for (const auto& scanner : measurements) {
+            AOC_TRACE_ZONE("day19::beaconDistances");
+            distances.emplace_back();
+            for (const auto& beacon : scanner) {
+                distances.back().emplace_back();
+                for (const auto& other : scanner) {
+                    const auto distance = manhattanDistance(beacon, other);
+                    distances.back().back().emplace_back(distance);
+                }
+                ++numInputBeacons;
+            }
+        }
+
+        /* The pairs of scanners are matched in parallel by their first scanner. Every row keeps the smallest
+         * number of common beacons found for each of its pairs (0 for none, overlaps count 12 or more), so
+         * the rows never share any state. */
+        const auto numOverlapping = parallelReduce(
+                uz{ 0 }, distances.size(), uz{ 0 },
+                [&distances](const uz i) {
+                    AOC_TRACE_ZONE("day19::matchScanner");
+                    auto overlappingScanners = std::vector<uz>(distances.size(), 0);
+                    // the distance counts only live for one pair of beacons
+                    auto arena = Arena<16384>{};
+                    const auto& scanner = distances.at(i);
+                    for (const auto& beacon : scanner) {
+                        for (auto j = i + 1; j < distances.size(); ++j) {
+                            const auto& otherScanner = distances.at(j);
+                            for (const auto& otherBeacon : otherScanner) {
+                                arena.reset();
+                                auto counts = std::array{
+                                    std::pmr::unordered_map<i64, uz>{ beacon.size(), arena.resource() },
+                                    std::pmr::unordered_map<i64, uz>{ otherBeacon.size(), arena.resource() },
+                                };
+                                for (const auto distance : beacon) {
+                                    counts[0][distance] = counts[0].contains(distance) ? counts[0][distance] + 1 : 1;
+                                }
+                                for (const auto distance : otherBeacon) {
+                                    counts[1][distance] = counts[1].contains(distance) ? counts[1][distance] + 1 : 1;
+                                }
+                                auto overlapping = uz{};
+                                for (const auto& distanceCount : counts[0]) {
+                                    if (counts[1].contains(distanceCount.first)) {
+                                        overlapping += std::min(distanceCount.second, counts[1][distanceCount.first]);
+                                    }
+                                }
+                                if (overlapping >= 12) {
+                                    auto& smallest = overlappingScanners[j];
+                                    smallest = (smallest == 0) ? overlapping : std::min(smallest, overlapping);
+                                }
+                            }
+                        }
+                    }
+                    return std::accumulate(overlappingScanners.begin(), overlappingScanners.end(), uz{ 0 });
+                },
+                std::plus<>{});
+        const auto numBeacons = numInputBeacons - numOverlapping;
+        return numBeacons;
+    }
+}// namespace day19
+
+namespace {
+    // part 2 is not solved yet
+    const auto registration = PuzzleRegistration{ 19, "testcase.txt", day19::parse, day19::part1, nullptr };
+}
@@ -0,0 +1,14 @@
+#pragma once
+
+#include "AOCUtilities.hpp"
+#include <string_view>
+#include <vector>
+
+namespace day19 {
+    // the beacons measured by every scanner
+    using Measurements = std::vector<std::vector<Point3D<i64>>>;
+
+    [[nodiscard]] Measurements parse(std::string_view input);
+    // number of distinct beacons
+    [[nodiscard]] uz part1(const Measurements& measurements);
+}// namespace day19
@@ -0,0 +1,104 @@
+#include "Day20.hpp"
+#include "GridRenderer.hpp"
+#include "Puzzle.hpp"
+#include "Trace.hpp"
+#include <algorithm>
+#include <array>
+#include <ostream>
+
+namespace day20 {
+    void Image::setPixel(const i32 x, const i32 y, const Color color) {
+        if (!pixels.contains(x, y)) {
+            throw std::runtime_error{ "Coordinates outside of the grid. " };
+        }
+        pixels.set(x, y, color == Color::Light);
+    }
+
+    uz Image::numLightPixels() const {
+        return pixels.count();
+    }
+
+    std::ostream& operator<<(std::ostream& os, const Color& color) {
+        os << (color == Color::Light ? '#' : '.');
+        return os;
+    }
+
+    std::ostream& operator<<(std::ostream& os, const Image& image) {
+        GridRenderer{ image.pixels.width(), image.pixels.height() }
+                .cells([&](const uz x, const uz y) { return image.pixels(x, y) ? '#' : '.'; })
+                .write(os);
+        return os;
+    }
+
+    Image processImage(const Image& image, const std::string_view algorithm) {
+        AOC_TRACE_ZONE("day20::processImage");
+        // bits() has the left pixel in the lowest bit, the algorithm in the most significant one, so the index
+        // of every 3x3 neighborhood is reversed once here instead of for every pixel
+        auto isLight = std::array<bool, 512>{};
+        for (auto index = uz{ 0 }; index < isLight.size(); ++index) {
+            isLight[index] = (algorithm[reverseBits(index) >> (bitsPerWord - 9)] == '#');
+        }
+        const auto& pixels = image.pixels;
+        auto newImage = Image{ pixels.width() + 2, pixels.height() + 2,
+                               isLight[image.background == Color::Light ? 511 : 0] ? Color::Light : Color::Dark };
+        // the pixel (x, y) of the new image is the pixel (x - 1, y - 1) of the old one, its neighborhood are the
+        // old pixels x - 2 to x in the rows y - 2 to y
+        constexpr auto chunkSize = uz{ 55 };
+        const auto width = newImage.pixels.width();
+        for (auto y = uz{ 0 }; y < newImage.pixels.height(); ++y) {
+            for (auto chunk = uz{ 0 }; chunk < width; chunk += chunkSize) {
+                auto top = pixels.bits(chunk - 2, y - 2, chunkSize + 2);
+                auto middle = pixels.bits(chunk - 2, y - 1, chunkSize + 2);
+                auto bottom = pixels.bits(chunk - 2, y, chunkSize + 2);
+                const auto numPixels = std::min(chunkSize, width - chunk);
+                auto lightPixels = BitWord{ 0 };
+                for (auto offset = uz{ 0 }; offset < numPixels; ++offset) {
+                    const auto index = (top & 0b111) | (middle & 0b111) << 3 | (bottom & 0b111) << 6;
+                    lightPixels |= BitWord{ isLight[index] } << offset;
+                    top >>= 1;
+                    middle >>= 1;
+                    bottom >>= 1;
+                }
+                newImage.pixels.setBits(chunk, y, numPixels, lightPixels);
+            }
+        }
+        return newImage;
+    }
+
+    Input parse(const std::string_view text) {
+        AOC_TRACE_ZONE("day20::parse");
+        const auto lines = splitLines(text);
+        auto result = Input{ std::string{ lines.front() },
+                             Image{ lines.at(2).length(), lines.size() - 2, Color::Dark } };
+        auto& pixels = result.image.pixels;
+        for (auto y = uz{ 0 }; y < pixels.height(); ++y) {
+            for (auto x = uz{ 0 }; x < pixels.width(); ++x) {
+                pixels.set(x, y, lines[y + 2].at(x) == '#');
+            }
+        }
+        return result;
+    }
+
+    Image enhance(const Input& input, const i32 numIterations) {
+        auto image = input.image;
+        for (auto iteration = 1; iteration <= numIterations; ++iteration) {
+            image = processImage(image, input.algorithm);
+            //std::cout << image << "===============\n";
+        }
+        return image;
+    }
+
+    uz part1(const Input& input) {
+        AOC_TRACE_ZONE("day20::part1");
+        return enhance(input, 2).numLightPixels();
+    }
+
+    uz part2(const Input& input) {
+        AOC_TRACE_ZONE("day20::part2");
+        return enhance(input, 50).numLightPixels();
+    }
+}// namespace day20
+
+namespace {
+    const auto registration = PuzzleRegistration{ 20, "input.txt", day20::parse, day20::part1, day20::part2 };
+}
@@ -0,0 +1,55 @@
+#pragma once
+
+#include "AOCUtilities.hpp"
+#include "BitGrid.hpp"
+#include <iosfwd>
+#include <string>
+#include <string_view>
+
+namespace day20 {
+    enum class Color {
+        Light,
+        Dark,
+    };
+
+    /* The pixels that can differ from the infinite background, surrounded by two rings of padding in the
+     * color of the background so that the 3x3 neighborhood of every pixel one step outside of the image is
+     * valid. Every enhancement grows the image by one pixel in each direction. */
+    struct Image {
+        static constexpr auto padding = uz{ 2 };
+
+        BitGrid pixels;// set for light pixels
+        Color background;
+
+        Image(uz width, uz height, Color background)
+            : pixels{ width, height, background == Color::Light, padding },
+              background{ background } { }
+
+        [[nodiscard]] Color getPixel(const i32 x, const i32 y) const {
+            if (!pixels.contains(x, y)) {
+                return background;
+            }
+            return pixels(x, y) ? Color::Light : Color::Dark;
+        }
+
+        void setPixel(i32 x, i32 y, Color color);
+
+        [[nodiscard]] uz numLightPixels() const;
+    };
+
+    std::ostream& operator<<(std::ostream& os, const Color& color);
+    std::ostream& operator<<(std::ostream& os, const Image& image);
+
+    struct Input {
+        std::string algorithm;
+        Image image;
+    };
+
+    [[nodiscard]] Input parse(std::string_view input);
+    [[nodiscard]] Image processImage(const Image& image, std::string_view algorithm);
+    [[nodiscard]] Image enhance(const Input& input, i32 numIterations);
+    // light pixels after 2 iterations
+    [[nodiscard]] uz part1(const Input& input);
+    // light pixels after 50 iterations
+    [[nodiscard]] uz part2(const Input& input);
+}// namespace day20
@@ -0,0 +1,140 @@
+#pragma once
+
+#include "AOCUtilities.hpp"
+#include <concepts>
+#include <iomanip>
+#include <ostream>
+#include <string>
+#include <string_view>
+#include <vector>
+
+// minimal streaming JSON writer for the benchmark reports, the caller is responsible for a valid nesting
+class JsonWriter {
+public:
+    explicit JsonWriter(std::ostream& stream) : mStream{ stream } { }
+
+    void beginObject() {
+        beginValue();
+        mStream << '{';
+        mHasElements.push_back(false);
+    }
+
+    void endObject() {
+        endContainer('}');
+    }
+
+    void beginArray() {
+        beginValue();
+        mStream << '[';
+        mHasElements.push_back(false);
+    }
+
+    void endArray() {
+        endContainer(']');
+    }
+
+    void key(const std::string_view name) {
+        beginValue();
+        writeString(name);
+        mStream << ": ";
+        mAfterKey = true;
+    }
+
+    void value(const std::string_view string) {
+        beginValue();
+        writeString(string);
+    }
+
+    void value(const char* const string) {
+        value(std::string_view{ string });
+    }
+
+    void value(const bool boolean) {
+        beginValue();
+        mStream << (boolean ? "true" : "false");
+    }
+
+    template<std::integral T>
+    void value(const T number) {
+        beginValue();
+        mStream << number;
+    }
+
+    template<std::floating_point T>
+    void value(const T number) {
+        beginValue();
+        mStream << std::fixed << std::setprecision(1) << number;
+    }
+
+    template<typename T>
+    void field(const std::string_view name, const T& fieldValue) {
+        key(name);
+        value(fieldValue);
+    }
+
+private:
+    void beginValue() {
+        if (mAfterKey) {
+            mAfterKey = false;
+            return;
+        }
+        if (!mHasElements.empty()) {
+            mStream << (mHasElements.back() ? ",\n" : "\n");
+            mHasElements.back() = true;
+            indent();
+        }
+    }
+
+    void endContainer(const char closing) {
+        const auto hadElements = mHasElements.back();
+        mHasElements.pop_back();
+        if (hadElements) {
+            mStream << '\n';
+            indent();
+        }
+        mStream << closing;
+        if (mHasElements.empty()) {
+            mStream << '\n';
+        }
+    }
+
+    void indent() {
+        mStream << std::string(mHasElements.size() * 2, ' ');
+    }
+
+    void writeString(const std::string_view string) {
+        static constexpr auto hexDigits = std::string_view{ "0123456789abcdef" };
+        mStream << '"';
+        for (const auto c : string) {
+            switch (c) {
+                case '"':
+                    mStream << "\\\"";
+                    break;
+                case '\\':
+                    mStream << "\\\\";
+                    break;
+                case '\n':
+                    mStream << "\\n";
+                    break;
+                case '\r':
+                    mStream << "\\r";
+                    break;
+                case '\t':
+                    mStream << "\\t";
+                    break;
+                default:
+                    if (static_cast<unsigned char>(c) < 0x20) {
+                        mStream << "\\u00" << hexDigits[(c >> 4) & 0xF] << hexDigits[c & 0xF];
+                    } else {
+                        mStream << c;
+                    }
+            }
+        }
+        mStream << '"';
+    }
+
+private:
+    std::ostream& mStream;
+    std::vector<bool> mHasElements;
+    bool mAfterKey{ false };
+};
@@ -0,0 +1,42 @@
+#pragma once
+
+#include "AOCUtilities.hpp"
+#include <algorithm>
+#include <numeric>
+#include <vector>
+#include <cmath>
+
+struct Summary {
+    uz samples{ 0 };
+    double min{ 0.0 };
+    double max{ 0.0 };
+    double mean{ 0.0 };
+    double median{ 0.0 };
+    double p95{ 0.0 };
+    double stddev{ 0.0 };
+};
+
+[[nodiscard]] inline Summary summarize(std::vector<double> samples) {
+    auto result = Summary{ .samples = samples.size() };
+    if (samples.empty()) {
+        return result;
+    }
+    std::sort(samples.begin(), samples.end());
+    const auto count = static_cast<double>(samples.size());
+    result.min = samples.front();
+    result.max = samples.back();
+    result.mean = std::accumulate(samples.begin(), samples.end(), 0.0) / count;
+    const auto middle = samples.size() / 2;
+    result.median = (samples.size() % 2 == 0 ? (samples[middle - 1] + samples[middle]) / 2.0 : samples[middle]);
+    // nearest-rank percentile
+    const auto p95Rank = static_cast<uz>(std::ceil(0.95 * count));
+    result.p95 = samples[std::max(p95Rank, uz{ 1 }) - 1];
+    if (samples.size() > 1) {
+        auto sumOfSquares = 0.0;
+        for (const auto sample : samples) {
+            sumOfSquares += (sample - result.mean) * (sample - result.mean);
+        }
+        result.stddev = std::sqrt(sumOfSquares / (count - 1.0));
+    }
+    return result;
+}
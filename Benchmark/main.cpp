@@ -0,0 +1,426 @@
+#include "AOCUtilities.hpp"
+#include "AllocationTracking.hpp"
+#include "CpuDispatch.hpp"
+#include "JsonWriter.hpp"
+#include "PerfCounters.hpp"
+#include "Puzzle.hpp"
+#include "Statistics.hpp"
+#include "ThreadPool.hpp"
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <ctime>
+#include <filesystem>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <memory>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <vector>
+
+/* Benchmark harness for every registered day. The parse, part 1 and part 2 phases are timed separately
+ * (after a number of warm-up runs) and summarized, together with their heap allocations and how far the heap
+ * in use grew at its peak, so memory regressions show up just like slowdowns. Besides the real puzzle inputs,
+ * scaled up inputs named dayNN.x<scale>.txt can be benchmarked to see how the solutions behave for larger
+ * inputs, and every run can be repeated with thread pools of different sizes to see how the parallel days
+ * scale with the number of cores. With --counters, the hardware performance counters of every phase tell
+ * whether it is bound by the caches or by mispredicted branches, as IPC and events per line of input. */
+
+using Clock = std::chrono::steady_clock;
+
+struct Options {
+    std::vector<u32> days;// all registered days if empty
+    uz warmup{ 2 };
+    uz repetitions{ 10 };
+    std::vector<u32> scales{ 1 };
+    std::vector<u32> threads;// the default size of the thread pool if empty
+    std::filesystem::path inputRoot{ AOC_SOURCE_DIR };
+    std::filesystem::path scaledInputs{ "scaled-inputs" };
+    std::string jsonPath;
+    std::string label;
+    bool parseCache{ false };
+    bool counters{ false };
+};
+
+struct MemoryUsage {
+    AllocationCount allocations;
+    u64 peakHeapBytes{ 0 };// above the heap in use at the start of the phase
+};
+
+struct PhaseResult {
+    std::string_view name;
+    Summary nanoseconds;
+    std::string answer;
+    MemoryUsage memory;// of the last repetition, every repetition does the same work
+    PerfCounts counters;// mean of the repetitions, empty without --counters
+};
+
+struct BenchmarkResult {
+    u32 day;
+    u32 scale;
+    uz threads;
+    std::string inputPath;
+    uz inputBytes;
+    uz inputLines;
+    std::vector<PhaseResult> phases;
+};
+
+constexpr auto usage = std::string_view{
+    "Usage: aoc_bench [options]\n"
+    "  --days 1,5,9          only benchmark the given days (default: all)\n"
+    "  --warmup N            untimed runs before measuring (default: 2)\n"
+    "  --repetitions N       timed runs per phase (default: 10)\n"
+    "  --scales 1,4,16       input scale factors, 1 is the real puzzle input (default: 1)\n"
+    "  --scaled-inputs DIR   directory containing dayNN.x<scale>.txt (default: scaled-inputs)\n"
+    "  --threads 1,2,4,8     thread pool sizes to run with (default: $AOC_THREADS or all hardware threads)\n"
+    "  --input-root DIR      directory containing the AdventOfCodeNN directories\n"
+    "  --json FILE           write the results as JSON (- for stdout)\n"
+    "  --label TEXT          free text stored in the JSON, e.g. the commit\n"
+    "  --parse-cache         parse through the binary sidecar (input.txt.bin) for the days that have one\n"
+    "  --counters            read the hardware performance counters of every phase (Linux, calling thread only)\n"
+};
+
+[[nodiscard]] std::vector<u32> parseList(const std::string_view list) {
+    auto result = std::vector<u32>{};
+    appendIntegers(list, result);
+    return result;
+}
+
+[[nodiscard]] Options parseOptions(const int argc, char** const argv) {
+    auto options = Options{};
+    for (auto i = 1; i < argc; ++i) {
+        const auto argument = std::string_view{ argv[i] };
+        if (argument == "--help" || argument == "-h") {
+            std::cout << usage;
+            std::exit(0);
+        }
+        if (argument == "--parse-cache") {
+            options.parseCache = true;
+            continue;
+        }
+        if (argument == "--counters") {
+            options.counters = true;
+            continue;
+        }
+        if (i + 1 >= argc) {
+            throw std::runtime_error{ "Missing value for option " + std::string{ argument } + ". " };
+        }
+        const auto value = std::string_view{ argv[++i] };
+        if (argument == "--days") {
+            options.days = parseList(value);
+        } else if (argument == "--warmup") {
+            options.warmup = parseInteger<uz>(value);
+        } else if (argument == "--repetitions") {
+            options.repetitions = std::max(parseInteger<uz>(value), uz{ 1 });
+        } else if (argument == "--scales") {
+            options.scales = parseList(value);
+        } else if (argument == "--threads") {
+            options.threads = parseList(value);
+            if (std::find(options.threads.begin(), options.threads.end(), 0u) != options.threads.end()) {
+                throw std::runtime_error{ "The number of threads has to be positive. " };
+            }
+        } else if (argument == "--scaled-inputs") {
+            options.scaledInputs = value;
+        } else if (argument == "--input-root") {
+            options.inputRoot = value;
+        } else if (argument == "--json") {
+            options.jsonPath = value;
+        } else if (argument == "--label") {
+            options.label = value;
+        } else {
+            throw std::runtime_error{ "Unknown option " + std::string{ argument } + ". " };
+        }
+    }
+    return options;
+}
+
+[[nodiscard]] std::filesystem::path inputPath(const Options& options, const Puzzle& puzzle, const u32 scale) {
+    if (scale == 1) {
+        return puzzle.inputPath(options.inputRoot);
+    }
+    auto dayString = std::to_string(puzzle.day());
+    if (dayString.length() < 2) {
+        dayString.insert(0, 1, '0');
+    }
+    return options.scaledInputs / ("day" + dayString + ".x" + std::to_string(scale) + ".txt");
+}
+
+// adds the counts of the run to counters if there is a counter group
+template<typename Function>
+[[nodiscard]] double measureNanoseconds(MemoryUsage& memory,
+                                        PerfCounterGroup* const counterGroup,
+                                        std::optional<PerfCounts>& counters,
+                                        Function&& function) {
+    const auto allocationsBefore = allocationCount();
+    const auto heapBytesBefore = heapBytesInUse();
+    resetPeakHeapBytes();
+    if (counterGroup != nullptr) {
+        counterGroup->start();
+    }
+    const auto start = Clock::now();
+    function();
+    const auto end = Clock::now();
+    if (counterGroup != nullptr) {
+        const auto counts = counterGroup->stop();
+        counters = counters ? *counters + counts : counts;
+    }
+    memory = MemoryUsage{ allocationCount() - allocationsBefore, peakHeapBytes() - heapBytesBefore };
+    return std::chrono::duration<double, std::nano>(end - start).count();
+}
+
+[[nodiscard]] std::vector<PhaseResult> benchmarkPuzzle(const Puzzle& puzzle,
+                                                       const std::filesystem::path& path,
+                                                       const std::string_view input,
+                                                       const Options& options,
+                                                       PerfCounterGroup* const counterGroup) {
+    // with the cache, the first run (a warmup one, if there is any) writes the sidecar and the others load it
+    const auto parse = [&]() {
+        return options.parseCache ? puzzle.parseCached(path, input) : puzzle.parse(input);
+    };
+    for (auto i = uz{ 0 }; i < options.warmup; ++i) {
+        const auto parsed = parse();
+        static_cast<void>(puzzle.part1(parsed.get()));
+        static_cast<void>(puzzle.part2(parsed.get()));
+    }
+
+    auto parseTimes = std::vector<double>{};
+    auto part1Times = std::vector<double>{};
+    auto part2Times = std::vector<double>{};
+    auto answer1 = std::string{};
+    auto answer2 = std::string{};
+    auto parseMemory = MemoryUsage{};
+    auto part1Memory = MemoryUsage{};
+    auto part2Memory = MemoryUsage{};
+    auto parseCounters = std::optional<PerfCounts>{};
+    auto part1Counters = std::optional<PerfCounts>{};
+    auto part2Counters = std::optional<PerfCounts>{};
+    for (auto i = uz{ 0 }; i < options.repetitions; ++i) {
+        // declared inside of the loop so that the previous result is not destroyed during the measurement
+        auto parsed = std::shared_ptr<const void>{};
+        parseTimes.push_back(measureNanoseconds(parseMemory, counterGroup, parseCounters, [&]() { parsed = parse(); }));
+        part1Times.push_back(measureNanoseconds(part1Memory, counterGroup, part1Counters,
+                                                [&]() { answer1 = puzzle.part1(parsed.get()); }));
+        if (puzzle.hasPart2()) {
+            part2Times.push_back(measureNanoseconds(part2Memory, counterGroup, part2Counters,
+                                                    [&]() { answer2 = puzzle.part2(parsed.get()); }));
+        }
+    }
+
+    const auto repetitions = static_cast<double>(options.repetitions);
+    const auto mean = [&](const std::optional<PerfCounts>& counters) {
+        return counters ? *counters / repetitions : PerfCounts{};
+    };
+    auto result = std::vector<PhaseResult>{};
+    result.push_back(
+            PhaseResult{ "parse", summarize(std::move(parseTimes)), {}, parseMemory, mean(parseCounters) });
+    result.push_back(PhaseResult{ "part1", summarize(std::move(part1Times)), std::move(answer1), part1Memory,
+                                  mean(part1Counters) });
+    if (puzzle.hasPart2()) {
+        result.push_back(PhaseResult{ "part2", summarize(std::move(part2Times)), std::move(answer2), part2Memory,
+                                      mean(part2Counters) });
+    }
+    return result;
+}
+
+// IPC and the other events per line of input, below the timings of a phase
+void printCounters(const PerfCounts& counters, const uz inputLines) {
+    if (std::none_of(counters.values.begin(), counters.values.end(), [](const auto value) { return value; })) {
+        return;
+    }
+    std::cout << std::string(22, ' ') << std::fixed << std::setprecision(2);
+    if (const auto ipc = counters.ipc()) {
+        std::cout << "IPC " << *ipc << "  ";
+    }
+    std::cout << "per line:";
+    const auto lines = static_cast<double>(std::max(inputLines, uz{ 1 }));
+    for (auto i = uz{ 0 }; i < numPerfEvents; ++i) {
+        if (counters.values[i]) {
+            std::cout << "  " << perfEventName(static_cast<PerfEvent>(i)) << " " << *counters.values[i] / lines;
+        }
+    }
+    std::cout << "\n";
+}
+
+void printResult(const BenchmarkResult& result) {
+    const auto milliseconds = [](const double nanoseconds) { return nanoseconds / 1'000'000.0; };
+    for (const auto& phase : result.phases) {
+        // multi-line answers (like rendered images) are cut off after the first line
+        const auto answer = std::string_view{ phase.answer }.substr(0, phase.answer.find('\n'));
+        std::cout << "Day " << std::setw(2) << std::setfill('0') << result.day << std::setfill(' ') << "  x"
+                  << std::left << std::setw(5) << result.scale << "t" << std::setw(4) << result.threads
+                  << std::setw(7) << phase.name << std::right
+                  << std::fixed << std::setprecision(3) << std::setw(12) << milliseconds(phase.nanoseconds.median)
+                  << " ms  p95 " << std::setw(12) << milliseconds(phase.nanoseconds.p95) << " ms  sd "
+                  << std::setw(10) << milliseconds(phase.nanoseconds.stddev) << " ms  allocs " << std::setw(9)
+                  << phase.memory.allocations.allocations << "  peak " << std::setw(9)
+                  << (phase.memory.peakHeapBytes + 1023) / 1024 << " KiB  " << answer << "\n";
+        printCounters(phase.counters, result.inputLines);
+    }
+}
+
+// speedup of every run over the run of the same phase with the first thread pool size
+void printScaling(const std::vector<BenchmarkResult>& results) {
+    std::cout << "\nSpeedup over the first number of threads\n";
+    const BenchmarkResult* baseline = nullptr;
+    for (const auto& result : results) {
+        if (baseline == nullptr || baseline->day != result.day || baseline->scale != result.scale) {
+            baseline = &result;
+        }
+        std::cout << "Day " << std::setw(2) << std::setfill('0') << result.day << std::setfill(' ') << "  x"
+                  << std::left << std::setw(5) << result.scale << "t" << std::setw(4) << result.threads
+                  << std::right << std::fixed << std::setprecision(2);
+        for (auto i = uz{ 0 }; i < result.phases.size(); ++i) {
+            std::cout << "  " << result.phases[i].name << std::setw(7)
+                      << baseline->phases[i].nanoseconds.median / result.phases[i].nanoseconds.median << "x";
+        }
+        std::cout << "\n";
+    }
+}
+
+[[nodiscard]] std::string compilerName() {
+#if defined(__clang__)
+    return "clang " __clang_version__;
+#elif defined(__GNUC__)
+    return "gcc " __VERSION__;
+#elif defined(_MSC_VER)
+    return "msvc " + std::to_string(_MSC_VER);
+#else
+    return "unknown";
+#endif
+}
+
+[[nodiscard]] std::string currentTimestamp() {
+    const auto now = std::time(nullptr);
+    auto buffer = std::array<char, 32>{};
+    std::strftime(buffer.data(), buffer.size(), "%Y-%m-%dT%H:%M:%SZ", std::gmtime(&now));
+    return std::string{ buffer.data() };
+}
+
+// in the order of PerfEvent
+constexpr auto perfEventJsonNames = std::array<std::string_view, numPerfEvents>{
+    "cycles", "instructions", "l1dMisses", "llcMisses", "branchMisses"
+};
+
+void writeJson(std::ostream& stream, const Options& options, const std::vector<BenchmarkResult>& results) {
+    auto json = JsonWriter{ stream };
+    json.beginObject();
+    json.field("label", options.label);
+    json.field("timestamp", currentTimestamp());
+    json.field("compiler", compilerName());
+    json.field("buildType", AOC_BUILD_TYPE);
+    json.field("simdTier", simdTierName(activeSimdTier()));
+    json.field("warmup", options.warmup);
+    json.field("repetitions", options.repetitions);
+    json.key("results");
+    json.beginArray();
+    for (const auto& result : results) {
+        json.beginObject();
+        json.field("day", result.day);
+        json.field("scale", result.scale);
+        json.field("threads", result.threads);
+        json.field("input", result.inputPath);
+        json.field("inputBytes", result.inputBytes);
+        json.field("inputLines", result.inputLines);
+        json.key("phases");
+        json.beginArray();
+        for (const auto& phase : result.phases) {
+            json.beginObject();
+            json.field("phase", phase.name);
+            json.field("samples", phase.nanoseconds.samples);
+            json.field("minNs", phase.nanoseconds.min);
+            json.field("medianNs", phase.nanoseconds.median);
+            json.field("meanNs", phase.nanoseconds.mean);
+            json.field("p95Ns", phase.nanoseconds.p95);
+            json.field("maxNs", phase.nanoseconds.max);
+            json.field("stddevNs", phase.nanoseconds.stddev);
+            json.field("allocations", phase.memory.allocations.allocations);
+            json.field("allocatedBytes", phase.memory.allocations.bytes);
+            json.field("peakHeapBytes", phase.memory.peakHeapBytes);
+            // IPC and the events per line follow from these and inputLines
+            for (auto i = uz{ 0 }; i < numPerfEvents; ++i) {
+                if (phase.counters.values[i]) {
+                    json.field(perfEventJsonNames[i], *phase.counters.values[i]);
+                }
+            }
+            if (!phase.answer.empty()) {
+                json.field("answer", phase.answer);
+            }
+            json.endObject();
+        }
+        json.endArray();
+        json.endObject();
+    }
+    json.endArray();
+    json.endObject();
+}
+
+int main(const int argc, char** const argv) {
+    try {
+        const auto options = parseOptions(argc, argv);
+        auto puzzles = registeredPuzzles();
+        if (!options.days.empty()) {
+            std::erase_if(puzzles, [&](const auto puzzle) {
+                return std::find(options.days.begin(), options.days.end(), puzzle->day()) == options.days.end();
+            });
+        }
+
+        // opened once, the counters of the main thread follow every phase
+        auto counterGroup = std::optional<PerfCounterGroup>{};
+        if (options.counters) {
+            counterGroup.emplace();
+            if (!counterGroup->available()) {
+                std::cerr << "Hardware performance counters are unavailable (" << counterGroup->error()
+                          << "), measuring without them\n";
+                counterGroup.reset();
+            } else if (!counterGroup->error().empty()) {
+                std::cerr << "Some hardware performance counters are unavailable (" << counterGroup->error() << ")\n";
+            }
+        }
+
+        auto results = std::vector<BenchmarkResult>{};
+        for (const auto scale : options.scales) {
+            for (const auto puzzle : puzzles) {
+                const auto path = inputPath(options, *puzzle, scale);
+                if (!std::filesystem::exists(path)) {
+                    std::cerr << "Skipping day " << puzzle->day() << " x" << scale << ": " << path.string()
+                              << " does not exist\n";
+                    continue;
+                }
+                const auto input = MappedInput{ path.string() };
+                const auto runWithCurrentPool = [&]() {
+                    auto& result = results.emplace_back(BenchmarkResult{
+                            puzzle->day(), scale, threadPool().numThreads(), path.string(), input.contents().size(),
+                            input.lines().size(),
+                            benchmarkPuzzle(*puzzle, path, input.contents(), options,
+                                            counterGroup ? &*counterGroup : nullptr) });
+                    printResult(result);
+                };
+                if (options.threads.empty()) {
+                    runWithCurrentPool();
+                }
+                for (const auto numThreads : options.threads) {
+                    resizeThreadPool(numThreads);
+                    runWithCurrentPool();
+                }
+            }
+        }
+        if (options.threads.size() > 1) {
+            printScaling(results);
+        }
+
+        if (options.jsonPath == "-") {
+            writeJson(std::cout, options, results);
+        } else if (!options.jsonPath.empty()) {
+            auto file = std::ofstream{ options.jsonPath };
+            if (!file) {
+                throw std::runtime_error{ "Unable to open file. " };
+            }
+            writeJson(file, options, results);
+        }
+    } catch (const std::exception& exception) {
+        std::cerr << exception.what() << "\n" << usage;
+        return 1;
+    }
+}
@@ -0,0 +1,157 @@
+#include "AOCUtilities.hpp"
+#include "Puzzle.hpp"
+#include "PuzzleMain.hpp"
+#include "ThreadPool.hpp"
+#include <algorithm>
+#include <chrono>
+#include <filesystem>
+#include <iomanip>
+#include <iostream>
+#include <map>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <vector>
+
+/* Runs the registered days back to back in one process, so the thread pool, the heap and the caches stay warm
+ * between them instead of every AdventOfCodeNN paying the start of a new process. Prints the answers of
+ * every day and the time of its fastest repetition, parsing included. */
+
+using Clock = std::chrono::steady_clock;
+
+struct Options {
+    std::vector<u32> days;// all registered days if empty
+    uz repetitions{ 1 };
+    uz threads{ 0 };// the default size of the thread pool if 0
+    std::filesystem::path inputRoot{ AOC_SOURCE_DIR };
+    std::map<u32, std::filesystem::path> inputs;// replace the input file of single days
+    PartSelection parts;
+    bool parseCache{ true };
+};
+
+constexpr auto usage = std::string_view{
+    "Usage: aoc [options]\n"
+    "  --days 1,5,9          only run the given days (default: all)\n"
+    "  --repeat N            run every day N times and report the fastest run (default: 1)\n"
+    "  --threads N           size of the thread pool (default: $AOC_THREADS or all hardware threads)\n"
+    "  --input-root DIR      directory containing the AdventOfCodeNN directories\n"
+    "  --input DAY=FILE      input file of one day, can be given several times\n"
+    "  --part 1|2            only solve one part of every day (default: both)\n"
+    "  --no-parse-cache      always parse the text, instead of loading and writing input.txt.bin sidecars\n"
+};
+
+[[nodiscard]] Options parseOptions(const int argc, char** const argv) {
+    auto options = Options{};
+    for (auto i = 1; i < argc; ++i) {
+        const auto argument = std::string_view{ argv[i] };
+        if (argument == "--help" || argument == "-h") {
+            std::cout << usage;
+            std::exit(0);
+        }
+        if (argument == "--no-parse-cache") {
+            options.parseCache = false;
+            continue;
+        }
+        if (i + 1 >= argc) {
+            throw std::runtime_error{ "Missing value for option " + std::string{ argument } + ". " };
+        }
+        const auto value = std::string_view{ argv[++i] };
+        if (argument == "--days") {
+            options.days.clear();
+            appendIntegers(value, options.days);
+        } else if (argument == "--repeat") {
+            options.repetitions = std::max(parseInteger<uz>(value), uz{ 1 });
+        } else if (argument == "--threads") {
+            options.threads = parseInteger<uz>(value);
+        } else if (argument == "--part") {
+            options.parts = PartSelection::fromString(value);
+        } else if (argument == "--input-root") {
+            options.inputRoot = value;
+        } else if (argument == "--input") {
+            const auto separator = value.find('=');
+            if (separator == std::string_view::npos) {
+                throw std::runtime_error{ "Expected DAY=FILE for --input. " };
+            }
+            options.inputs[parseInteger<u32>(value.substr(0, separator))] = value.substr(separator + 1);
+        } else {
+            throw std::runtime_error{ "Unknown option " + std::string{ argument } + ". " };
+        }
+    }
+    return options;
+}
+
+struct Answers {
+    std::string part1;
+    std::string part2;
+};
+
+[[nodiscard]] Answers solve(const Puzzle& puzzle,
+                            const std::filesystem::path& path,
+                            const std::string_view input,
+                            const Options& options) {
+    const auto parsed = options.parseCache ? puzzle.parseCached(path, input) : puzzle.parse(input);
+    auto answers = Answers{};
+    if (options.parts.part1) {
+        answers.part1 = puzzle.part1(parsed.get());
+    }
+    if (options.parts.part2 && puzzle.hasPart2()) {
+        answers.part2 = puzzle.part2(parsed.get());
+    }
+    return answers;
+}
+
+int main(const int argc, char** const argv) {
+    try {
+        const auto options = parseOptions(argc, argv);
+        if (options.threads != 0) {
+            resizeThreadPool(options.threads);
+        }
+        auto puzzles = registeredPuzzles();
+        if (!options.days.empty()) {
+            for (const auto day : options.days) {
+                if (findPuzzle(day) == nullptr) {
+                    throw std::runtime_error{ "Day " + std::to_string(day) + " is not registered. " };
+                }
+            }
+            std::erase_if(puzzles, [&](const auto puzzle) {
+                return std::find(options.days.begin(), options.days.end(), puzzle->day()) == options.days.end();
+            });
+        }
+
+        auto total = Clock::duration{ 0 };
+        for (const auto puzzle : puzzles) {
+            const auto override = options.inputs.find(puzzle->day());
+            const auto path = (override != options.inputs.end()) ? override->second
+                                                                 : puzzle->inputPath(options.inputRoot);
+            if (!std::filesystem::exists(path)) {
+                std::cerr << "Skipping day " << puzzle->day() << ": " << path.string() << " does not exist\n";
+                continue;
+            }
+            const auto input = MappedInput{ path.string() };
+            auto answers = Answers{};
+            auto fastest = Clock::duration::max();
+            for (auto i = uz{ 0 }; i < options.repetitions; ++i) {
+                const auto start = Clock::now();
+                answers = solve(*puzzle, path, input.contents(), options);
+                fastest = std::min(fastest, Clock::now() - start);
+            }
+            total += fastest;
+
+            std::cout << "Day " << std::setw(2) << std::setfill('0') << puzzle->day() << std::setfill(' ') << "  "
+                      << std::fixed << std::setprecision(3)
+                      << std::chrono::duration<double, std::milli>(fastest).count() << " ms\n";
+            if (options.parts.part1) {
+                printAnswer(std::cout, "part 1", answers.part1);
+            }
+            if (options.parts.part2 && puzzle->hasPart2()) {
+                printAnswer(std::cout, "part 2", answers.part2);
+            }
+        }
+        std::cout << "Total   " << std::fixed << std::setprecision(3)
+                  << std::chrono::duration<double, std::milli>(total).count() << " ms on "
+                  << threadPool().numThreads() << (threadPool().numThreads() == 1 ? " thread\n" : " threads\n");
+    } catch (const std::exception& exception) {
+        std::cerr << exception.what() << "\n" << usage;
+        return 1;
+    }
+}
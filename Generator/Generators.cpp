@@ -0,0 +1,599 @@
+#include "Generators.hpp"
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <numeric>
+#include <set>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace {
+    using namespace std::string_view_literals;
+
+    // sonar sweep: slowly increasing depths
+    void generateDay01(Random& random, const u32 scale, std::ostream& output) {
+        auto depth = i64{ 150 };
+        for (auto i = u32{ 0 }; i < 2000 * scale; ++i) {
+            depth = std::max(depth + random.between(i64{ -15 }, i64{ 25 }), i64{ 0 });
+            output << depth << '\n';
+        }
+    }
+
+    // dive: slightly more down than up commands, so the submarine stays below the surface
+    void generateDay02(Random& random, const u32 scale, std::ostream& output) {
+        for (auto i = u32{ 0 }; i < 1000 * scale; ++i) {
+            const auto command = random.between(0, 99);
+            output << (command < 50 ? "forward" : (command < 77 ? "down" : "up")) << ' ' << random.between(1, 9)
+                   << '\n';
+        }
+    }
+
+    [[nodiscard]] bool hasUniqueRating(std::vector<u32> values, const u32 numBits, const bool keepMostCommon) {
+        for (auto bit = numBits; bit-- > 0 && values.size() > 1;) {
+            const auto numOnes = std::count_if(values.begin(), values.end(), [bit](const auto value) {
+                return ((value >> bit) & 1) == 1;
+            });
+            const auto mostCommon = (2 * static_cast<uz>(numOnes) >= values.size() ? 1U : 0U);
+            std::erase_if(values, [&](const auto value) {
+                return (((value >> bit) & 1) == mostCommon) != keepMostCommon;
+            });
+        }
+        return values.size() == 1;
+    }
+
+    /* binary diagnostic: distinct numbers, redrawn until both ratings are unique (the puzzle never filters
+     * out all remaining numbers) */
+    void generateDay03(Random& random, const u32 scale, std::ostream& output) {
+        const auto count = 1000 * scale;
+        const auto numBits = std::max(u32{ 12 }, static_cast<u32>(std::bit_width(count)) + 1);
+        auto candidates = std::vector<u32>(uz{ 1 } << numBits);
+        std::iota(candidates.begin(), candidates.end(), u32{ 0 });
+        auto values = std::vector<u32>{};
+        do {
+            random.shuffle(candidates);
+            values.assign(candidates.begin(), candidates.begin() + count);
+        } while (!hasUniqueRating(values, numBits, true) || !hasUniqueRating(values, numBits, false));
+        for (const auto value : values) {
+            for (auto bit = numBits; bit-- > 0;) {
+                output << (((value >> bit) & 1) == 1 ? '1' : '0');
+            }
+            output << '\n';
+        }
+    }
+
+    using Board = std::array<u32, 25>;
+
+    // the draw after which the board has a complete row or column
+    [[nodiscard]] uz winningTurn(const Board& board, const std::array<uz, 100>& drawnAt) {
+        auto result = drawnAt.size();
+        for (auto i = uz{ 0 }; i < 5; ++i) {
+            auto rowComplete = uz{ 0 };
+            auto columnComplete = uz{ 0 };
+            for (auto j = uz{ 0 }; j < 5; ++j) {
+                rowComplete = std::max(rowComplete, drawnAt[board[j + 5 * i]]);
+                columnComplete = std::max(columnComplete, drawnAt[board[i + 5 * j]]);
+            }
+            result = std::min({ result, rowComplete, columnComplete });
+        }
+        return result;
+    }
+
+    /* giant squid: all numbers are drawn, so every board wins eventually. Boards are redrawn until exactly one
+     * of them wins first and exactly one wins last. */
+    void generateDay04(Random& random, const u32 scale, std::ostream& output) {
+        auto numbers = std::array<u32, 100>{};
+        std::iota(numbers.begin(), numbers.end(), u32{ 0 });
+        random.shuffle(numbers);
+        auto drawnAt = std::array<uz, 100>{};
+        for (auto i = uz{ 0 }; i < numbers.size(); ++i) {
+            drawnAt[numbers[i]] = i;
+            output << (i == 0 ? "" : ",") << numbers[i];
+        }
+        output << '\n';
+
+        auto shuffled = numbers;
+        const auto randomBoard = [&]() {
+            random.shuffle(shuffled);
+            auto board = Board{};
+            std::copy_n(shuffled.begin(), board.size(), board.begin());
+            return board;
+        };
+        auto boards = std::vector<Board>(100 * scale);
+        auto turns = std::vector<uz>(boards.size());
+        for (auto i = uz{ 0 }; i < boards.size(); ++i) {
+            boards[i] = randomBoard();
+            turns[i] = winningTurn(boards[i], drawnAt);
+        }
+        while (true) {
+            const auto [first, last] = std::minmax_element(turns.begin(), turns.end());
+            const auto tied = std::find_if(turns.begin(), turns.end(), [&](const auto& turn) {
+                return (&turn != &*first && turn == *first) || (&turn != &*last && turn == *last);
+            });
+            if (tied == turns.end()) {
+                break;
+            }
+            const auto index = static_cast<uz>(tied - turns.begin());
+            boards[index] = randomBoard();
+            turns[index] = winningTurn(boards[index], drawnAt);
+        }
+
+        for (const auto& board : boards) {
+            output << '\n';
+            for (auto y = uz{ 0 }; y < 5; ++y) {
+                for (auto x = uz{ 0 }; x < 5; ++x) {
+                    const auto number = board[x + 5 * y];
+                    output << (x == 0 ? "" : " ") << (number < 10 ? " " : "") << number;
+                }
+                output << '\n';
+            }
+        }
+    }
+
+    // hydrothermal venture: horizontal, vertical and 45 degree segments, the area stays the same
+    void generateDay05(Random& random, const u32 scale, std::ostream& output) {
+        constexpr auto extent = u32{ 1000 };
+        for (auto i = u32{ 0 }; i < 500 * scale; ++i) {
+            const auto x1 = random.between(u32{ 0 }, extent - 1);
+            const auto y1 = random.between(u32{ 0 }, extent - 1);
+            auto x2 = x1;
+            auto y2 = y1;
+            switch (random.between(0, 2)) {
+                case 0:
+                    x2 = random.between(u32{ 0 }, extent - 1);
+                    break;
+                case 1:
+                    y2 = random.between(u32{ 0 }, extent - 1);
+                    break;
+                default: {
+                    const auto right = random.chance(0.5);
+                    const auto down = random.chance(0.5);
+                    const auto maxLength = std::min(right ? extent - 1 - x1 : x1, down ? extent - 1 - y1 : y1);
+                    const auto length = random.between(u32{ 0 }, maxLength);
+                    x2 = (right ? x1 + length : x1 - length);
+                    y2 = (down ? y1 + length : y1 - length);
+                    break;
+                }
+            }
+            output << x1 << ',' << y1 << " -> " << x2 << ',' << y2 << '\n';
+        }
+    }
+
+    // lanternfish
+    void generateDay06(Random& random, const u32 scale, std::ostream& output) {
+        for (auto i = u32{ 0 }; i < 300 * scale; ++i) {
+            output << (i == 0 ? "" : ",") << random.between(1, 5);
+        }
+        output << '\n';
+    }
+
+    // the treachery of whales: more crabs in the same range of positions, skewed towards the left like the real input
+    void generateDay07(Random& random, const u32 scale, std::ostream& output) {
+        for (auto i = u32{ 0 }; i < 1000 * scale; ++i) {
+            output << (i == 0 ? "" : ",") << std::min(random.between(0, 1999), random.between(0, 1999));
+        }
+        output << '\n';
+    }
+
+    // seven segment search: every entry uses its own wiring
+    void generateDay08(Random& random, const u32 scale, std::ostream& output) {
+        constexpr auto segments = std::array{ "abcefg"sv, "cf"sv,     "acdeg"sv,   "acdfg"sv, "bcdf"sv,
+                                              "abdfg"sv,  "abdefg"sv, "acf"sv,     "abcdefg"sv, "abcdfg"sv };
+        auto wiring = std::array{ 'a', 'b', 'c', 'd', 'e', 'f', 'g' };
+        auto digits = std::array<uz, 10>{};
+        std::iota(digits.begin(), digits.end(), uz{ 0 });
+        const auto writeDigit = [&](const uz digit) {
+            auto pattern = std::string{};
+            for (const auto segment : segments[digit]) {
+                pattern += wiring[static_cast<uz>(segment - 'a')];
+            }
+            random.shuffle(pattern);
+            output << pattern;
+        };
+        for (auto i = u32{ 0 }; i < 200 * scale; ++i) {
+            random.shuffle(wiring);
+            random.shuffle(digits);
+            for (const auto digit : digits) {
+                writeDigit(digit);
+                output << ' ';
+            }
+            output << '|';
+            for (auto j = 0; j < 4; ++j) {
+                output << ' ';
+                writeDigit(random.between(uz{ 0 }, uz{ 9 }));
+            }
+            output << '\n';
+        }
+    }
+
+    /* smoke basin: walls of 9s split the map into basins, enough of them to stay below the percolation
+     * threshold so the basins remain small. Every basin gets exactly one low point, the height grows with the
+     * distance to it. */
+    void generateDay09(Random& random, const u32 scale, std::ostream& output) {
+        constexpr auto unassigned = u8{ 255 };
+        const auto size = uz{ 100 } * scale;
+        auto heights = std::vector<u8>(size * size);
+        for (auto& height : heights) {
+            height = (random.chance(0.45) ? 9 : unassigned);
+        }
+        auto basin = std::vector<uz>{};
+        auto distances = std::vector<uz>{};
+        // breadth-first search over the unassigned tiles, calls visit(tile, distance) for each of them
+        const auto floodFill = [&](const uz start, auto&& visit) {
+            basin.assign(1, start);
+            distances.assign(1, 0);
+            visit(start, uz{ 0 });
+            for (auto i = uz{ 0 }; i < basin.size(); ++i) {
+                const auto tile = basin[i];
+                const auto x = tile % size;
+                const auto y = tile / size;
+                const auto neighbors = std::array{ (y > 0 ? tile - size : tile), (y + 1 < size ? tile + size : tile),
+                                                   (x > 0 ? tile - 1 : tile), (x + 1 < size ? tile + 1 : tile) };
+                for (const auto neighbor : neighbors) {
+                    if (heights[neighbor] == unassigned) {
+                        basin.push_back(neighbor);
+                        distances.push_back(distances[i] + 1);
+                        visit(neighbor, distances[i] + 1);
+                    }
+                }
+            }
+        };
+        for (auto tile = uz{ 0 }; tile < heights.size(); ++tile) {
+            if (heights[tile] != unassigned) {
+                continue;
+            }
+            // collect the basin first to choose its low point
+            floodFill(tile, [&](const uz visited, uz) { heights[visited] = 0; });
+            for (const auto visited : basin) {
+                heights[visited] = unassigned;
+            }
+            floodFill(random.pick(basin), [&](const uz visited, const uz distance) {
+                heights[visited] = static_cast<u8>(std::min(distance, uz{ 8 }));
+            });
+        }
+        for (auto y = uz{ 0 }; y < size; ++y) {
+            for (auto x = uz{ 0 }; x < size; ++x) {
+                output << static_cast<char>('0' + heights[x + y * size]);
+            }
+            output << '\n';
+        }
+    }
+
+    // syntax scoring: the nesting depth is limited, so completion scores fit into 64 bits
+    void generateDay10(Random& random, const u32 scale, std::ostream& output) {
+        constexpr auto openers = "([{<"sv;
+        constexpr auto closers = ")]}>"sv;
+        constexpr auto maxDepth = uz{ 20 };
+        const auto writeLine = [&](const bool corrupted) {
+            const auto length = random.between(uz{ 90 }, uz{ 110 });
+            auto line = std::string{};
+            auto open = std::vector<uz>{};
+            while (line.length() < length || open.empty()) {
+                if (open.empty() || (open.size() < maxDepth && random.chance(0.55))) {
+                    open.push_back(random.between(uz{ 0 }, uz{ 3 }));
+                    line += openers[open.back()];
+                } else {
+                    line += closers[open.back()];
+                    open.pop_back();
+                }
+            }
+            if (corrupted) {
+                line += closers[(open.back() + random.between(uz{ 1 }, uz{ 3 })) % closers.size()];
+            }
+            output << line << '\n';
+        };
+        auto numIncomplete = uz{ 0 };
+        for (auto i = u32{ 0 }; i < 100 * scale; ++i) {
+            const auto corrupted = random.chance(0.5);
+            numIncomplete += (corrupted ? 0 : 1);
+            writeLine(corrupted);
+        }
+        // the middle completion score has to be unique
+        if (numIncomplete % 2 == 0) {
+            writeLine(false);
+        }
+    }
+
+    /* dumbo octopus: a square grid, 10x10 like the real input at scale 1. Random energy levels rarely
+     * synchronize (about a third of the 10x10 grids and practically none of the larger ones within thousands of
+     * steps), so the levels are drawn such that nothing flashes before the step syncStep and the first flash
+     * then spreads over the whole grid: in row-major order every octopus has up to four neighbors that flashed
+     * before it, which together with its own level exceed 9. */
+    void generateDay11(Random& random, const u32 scale, std::ostream& output) {
+        const auto size = 10 * scale;
+        const auto syncStep = random.between(1, 6);
+        for (auto y = u32{ 0 }; y < size; ++y) {
+            for (auto x = u32{ 0 }; x < size; ++x) {
+                // left, above left, above and above right
+                const auto numEarlierNeighbors =
+                        static_cast<int>(x > 0) * (1 + static_cast<int>(y > 0)) + static_cast<int>(y > 0) +
+                        static_cast<int>(y > 0 && x + 1 < size);
+                const auto level = random.between(std::max(10 - syncStep - numEarlierNeighbors, 0), 10 - syncStep);
+                output << static_cast<char>('0' + level);
+            }
+            output << '\n';
+        }
+    }
+
+    /* transparent origami: every fold halves the paper exactly, additional folds are added for bigger scales so
+     * that the result is always 40x6 */
+    void generateDay13(Random& random, const u32 scale, std::ostream& output) {
+        const auto numExtraFolds = static_cast<u32>(std::bit_width(scale)) - 1;
+        auto foldsX = std::vector<u32>{};
+        auto foldsY = std::vector<u32>{};
+        auto width = u32{ 40 };
+        auto height = u32{ 6 };
+        for (auto i = u32{ 0 }; i < 5 + numExtraFolds / 2; ++i) {
+            foldsX.insert(foldsX.begin(), width);
+            width = 2 * width + 1;
+        }
+        for (auto i = u32{ 0 }; i < 7 + (numExtraFolds + 1) / 2; ++i) {
+            foldsY.insert(foldsY.begin(), height);
+            height = 2 * height + 1;
+        }
+        const auto randomCoordinate = [&](const u32 size, const std::vector<u32>& folds) {
+            while (true) {
+                const auto coordinate = random.between(u32{ 0 }, size - 1);
+                if (std::find(folds.begin(), folds.end(), coordinate) == folds.end()) {
+                    return coordinate;
+                }
+            }
+        };
+        // the size of the paper is derived from the dots
+        output << width - 1 << ",0\n0," << height - 1 << '\n';
+        for (auto i = u32{ 0 }; i < 900 * scale; ++i) {
+            output << randomCoordinate(width, foldsX) << ',' << randomCoordinate(height, foldsY) << '\n';
+        }
+        output << '\n';
+        for (auto i = uz{ 0 }; i < std::max(foldsX.size(), foldsY.size()); ++i) {
+            if (i < foldsX.size()) {
+                output << "fold along x=" << foldsX[i] << '\n';
+            }
+            if (i < foldsY.size()) {
+                output << "fold along y=" << foldsY[i] << '\n';
+            }
+        }
+    }
+
+    // extended polymerization: a rule for every pair of elements
+    void generateDay14(Random& random, const u32 scale, std::ostream& output) {
+        constexpr auto elements = "BCFHKNOPSV"sv;
+        for (auto i = u32{ 0 }; i < 20 * scale; ++i) {
+            output << random.pick(elements);
+        }
+        output << "\n\n";
+        for (const auto first : elements) {
+            for (const auto second : elements) {
+                output << first << second << " -> " << random.pick(elements) << '\n';
+            }
+        }
+    }
+
+    // chiton
+    void generateDay15(Random& random, const u32 scale, std::ostream& output) {
+        const auto size = 100 * scale;
+        auto row = std::string(size, '1');
+        for (auto y = u32{ 0 }; y < size; ++y) {
+            for (auto& risk : row) {
+                risk = static_cast<char>('0' + random.between(1, 9));
+            }
+            output << row << '\n';
+        }
+    }
+
+    void appendBits(std::string& bits, const u64 value, const u32 numBits) {
+        for (auto bit = numBits; bit-- > 0;) {
+            bits += (((value >> bit) & 1) == 1 ? '1' : '0');
+        }
+    }
+
+    /* Appends a packet consisting of budget packets (fewer once the maximum depth is reached). Operators with a
+     * single sub-packet are common, so the trees get deep instead of only wide. */
+    void appendPacket(Random& random, std::string& bits, const u32 depth, const u32 budget) {
+        constexpr auto operatorTypes = std::array{ 0U, 1U, 2U, 3U, 5U, 6U, 7U };
+        appendBits(bits, random.between(0U, 7U), 3);
+        if (depth == 0 || budget <= 1) {
+            appendBits(bits, 4, 3);
+            const auto value = random.between(u64{ 0 }, (u64{ 1 } << random.between(4U, 16U)) - 1);
+            const auto numGroups = std::max(1U, static_cast<u32>(std::bit_width(value) + 3) / 4);
+            for (auto group = numGroups; group-- > 0;) {
+                appendBits(bits, (group == 0 ? 0U : 1U), 1);
+                appendBits(bits, value >> (4 * group), 4);
+            }
+            return;
+        }
+        const auto remaining = budget - 1;
+        auto type = random.pick(operatorTypes);
+        if (type >= 5 && remaining < 2) {
+            type = 0;
+        }
+        // comparisons have exactly two sub-packets
+        const auto numSubPackets = (type >= 5 ? 2U : std::min(random.between(1U, 4U), remaining));
+        auto subPackets = std::string{};
+        auto left = remaining;
+        for (auto i = u32{ 0 }; i < numSubPackets; ++i) {
+            const auto subBudget = (i + 1 == numSubPackets ? left : random.between(1U, left - (numSubPackets - 1 - i)));
+            appendPacket(random, subPackets, depth - 1, subBudget);
+            left -= subBudget;
+        }
+        appendBits(bits, type, 3);
+        if (subPackets.length() < (uz{ 1 } << 15) && random.chance(0.5)) {
+            appendBits(bits, 0, 1);
+            appendBits(bits, subPackets.length(), 15);
+        } else {
+            appendBits(bits, 1, 1);
+            appendBits(bits, numSubPackets, 11);
+        }
+        bits += subPackets;
+    }
+
+    // packet decoder: one transmission of roughly 250 packets per scale, nested up to 8 levels deeper per doubling
+    void generateDay16(Random& random, const u32 scale, std::ostream& output) {
+        const auto maxDepth = 8 * static_cast<u32>(std::bit_width(scale)) + 8;
+        auto bits = std::string{};
+        appendPacket(random, bits, maxDepth, 250 * scale);
+        bits.resize((bits.length() + 3) / 4 * 4, '0');
+        constexpr auto hexDigits = "0123456789ABCDEF"sv;
+        for (auto i = uz{ 0 }; i < bits.length(); i += 4) {
+            const auto nibble = (bits[i] - '0') * 8 + (bits[i + 1] - '0') * 4 + (bits[i + 2] - '0') * 2 + (bits[i + 3] - '0');
+            output << hexDigits[static_cast<uz>(nibble)];
+        }
+        output << '\n';
+    }
+
+    // trick shot: a target area further away, the number of velocities to try grows quadratically
+    void generateDay17(Random& random, const u32 scale, std::ostream& output) {
+        const auto minX = random.between(i64{ 20 }, i64{ 200 }) * scale;
+        const auto maxX = minX + random.between(i64{ 20 }, i64{ 60 }) * scale;
+        const auto minY = -random.between(i64{ 80 }, i64{ 160 }) * scale;
+        const auto maxY = minY + random.between(i64{ 20 }, i64{ 60 }) * scale;
+        output << "target area: x=" << minX << ".." << maxX << ", y=" << minY << ".." << maxY << '\n';
+    }
+
+    // reduced numbers only: at most four levels of nesting and no regular number above 9
+    void appendSnailfishNumber(Random& random, std::ostream& output, const u32 depth) {
+        output << '[';
+        for (auto i = 0; i < 2; ++i) {
+            output << (i == 0 ? "" : ",");
+            if (depth < 4 && random.chance(0.75)) {
+                appendSnailfishNumber(random, output, depth + 1);
+            } else {
+                output << random.between(0, 9);
+            }
+        }
+        output << ']';
+    }
+
+    // snailfish
+    void generateDay18(Random& random, const u32 scale, std::ostream& output) {
+        for (auto i = u32{ 0 }; i < 100 * scale; ++i) {
+            appendSnailfishNumber(random, output, 1);
+            output << '\n';
+        }
+    }
+
+    using Vector3 = std::array<i64, 3>;
+    using Matrix3 = std::array<Vector3, 3>;
+
+    // the 24 orientations: signed permutation matrices with a determinant of 1
+    [[nodiscard]] std::vector<Matrix3> rotations() {
+        auto result = std::vector<Matrix3>{};
+        auto axes = std::array{ 0, 1, 2 };
+        do {
+            const auto inversions = (axes[0] > axes[1]) + (axes[0] > axes[2]) + (axes[1] > axes[2]);
+            for (auto signs = 0; signs < 8; ++signs) {
+                auto matrix = Matrix3{};
+                auto determinant = (inversions % 2 == 0 ? 1 : -1);
+                for (auto row = 0; row < 3; ++row) {
+                    const auto sign = ((signs >> row) & 1) == 1 ? i64{ -1 } : i64{ 1 };
+                    matrix[row][axes[row]] = sign;
+                    determinant *= static_cast<int>(sign);
+                }
+                if (determinant == 1) {
+                    result.push_back(matrix);
+                }
+            }
+        } while (std::next_permutation(axes.begin(), axes.end()));
+        return result;
+    }
+
+    /* beacon scanner: every scanner shares at least 12 beacons with a scanner placed before it, so all of them
+     * can be aligned. Each scanner reports every beacon in range in its own orientation. */
+    void generateDay19(Random& random, const u32 scale, std::ostream& output) {
+        constexpr auto range = i64{ 1000 };
+        const auto orientations = rotations();
+        auto scanners = std::vector<Vector3>{ Vector3{ 0, 0, 0 } };
+        auto beacons = std::set<Vector3>{};
+        const auto addBeacons = [&](const Vector3& min, const Vector3& max, const u32 count) {
+            for (auto i = u32{ 0 }; i < count; ++i) {
+                beacons.insert(Vector3{ random.between(min[0], max[0]), random.between(min[1], max[1]),
+                                        random.between(min[2], max[2]) });
+            }
+        };
+        const auto ownBeacons = [&](const Vector3& scanner) {
+            addBeacons({ scanner[0] - range, scanner[1] - range, scanner[2] - range },
+                       { scanner[0] + range, scanner[1] + range, scanner[2] + range }, 14);
+        };
+        ownBeacons(scanners.front());
+        for (auto i = u32{ 1 }; i < 30 * scale; ++i) {
+            auto scanner = Vector3{};
+            auto overlapMin = Vector3{};
+            auto overlapMax = Vector3{};
+            // spread the scanners out like in the real input instead of piling them up around the first one
+            do {
+                const auto parent = random.pick(scanners);
+                for (auto axis = uz{ 0 }; axis < 3; ++axis) {
+                    const auto distance = random.between(i64{ 700 }, i64{ 1200 });
+                    scanner[axis] = parent[axis] + (random.chance(0.5) ? distance : -distance);
+                    overlapMin[axis] = std::max(parent[axis], scanner[axis]) - range;
+                    overlapMax[axis] = std::min(parent[axis], scanner[axis]) + range;
+                }
+            } while (std::any_of(scanners.begin(), scanners.end(), [&](const auto& other) {
+                return std::abs(other[0] - scanner[0]) < 700 && std::abs(other[1] - scanner[1]) < 700 &&
+                       std::abs(other[2] - scanner[2]) < 700;
+            }));
+            // distinct beacons, the set would silently drop duplicates
+            const auto targetSize = beacons.size() + 12;
+            while (beacons.size() < targetSize) {
+                addBeacons(overlapMin, overlapMax, 1);
+            }
+            ownBeacons(scanner);
+            scanners.push_back(scanner);
+        }
+
+        for (auto i = uz{ 0 }; i < scanners.size(); ++i) {
+            const auto& scanner = scanners[i];
+            const auto& rotation = random.pick(orientations);
+            auto measured = std::vector<Vector3>{};
+            for (const auto& beacon : beacons) {
+                const auto relative = Vector3{ beacon[0] - scanner[0], beacon[1] - scanner[1], beacon[2] - scanner[2] };
+                if (std::all_of(relative.begin(), relative.end(), [](const auto value) { return std::abs(value) <= range; })) {
+                    auto local = Vector3{};
+                    for (auto row = uz{ 0 }; row < 3; ++row) {
+                        local[row] = rotation[row][0] * relative[0] + rotation[row][1] * relative[1] +
+                                     rotation[row][2] * relative[2];
+                    }
+                    measured.push_back(local);
+                }
+            }
+            random.shuffle(measured);
+            output << (i == 0 ? "" : "\n") << "--- scanner " << i << " ---\n";
+            for (const auto& beacon : measured) {
+                output << beacon[0] << ',' << beacon[1] << ',' << beacon[2] << '\n';
+            }
+        }
+    }
+
+    // trench map: the first rule lights the infinite background and the last one turns it off again
+    void generateDay20(Random& random, const u32 scale, std::ostream& output) {
+        auto algorithm = std::string(512, '.');
+        for (auto& pixel : algorithm) {
+            pixel = (random.chance(0.5) ? '#' : '.');
+        }
+        algorithm.front() = '#';
+        algorithm.back() = '.';
+        output << algorithm << "\n\n";
+        const auto size = 100 * scale;
+        auto row = std::string(size, '.');
+        for (auto y = u32{ 0 }; y < size; ++y) {
+            for (auto& pixel : row) {
+                pixel = (random.chance(0.5) ? '#' : '.');
+            }
+            output << row << '\n';
+        }
+    }
+
+    constexpr auto generators = std::array{
+        InputGenerator{ 1, generateDay01 },   InputGenerator{ 2, generateDay02 },   InputGenerator{ 3, generateDay03 },
+        InputGenerator{ 4, generateDay04 },   InputGenerator{ 5, generateDay05 },   InputGenerator{ 6, generateDay06 },
+        InputGenerator{ 7, generateDay07 },   InputGenerator{ 8, generateDay08 },   InputGenerator{ 9, generateDay09 },
+        InputGenerator{ 10, generateDay10 }, InputGenerator{ 11, generateDay11 }, InputGenerator{ 13, generateDay13 },
+        InputGenerator{ 14, generateDay14 }, InputGenerator{ 15, generateDay15 }, InputGenerator{ 16, generateDay16 },
+        InputGenerator{ 17, generateDay17 }, InputGenerator{ 18, generateDay18 }, InputGenerator{ 19, generateDay19 },
+        InputGenerator{ 20, generateDay20 },
+    };
+}// namespace
+
+std::span<const InputGenerator> inputGenerators() {
+    return generators;
+}
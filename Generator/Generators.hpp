@@ -0,0 +1,20 @@
+#pragma once
+
+#include "AOCUtilities.hpp"
+#include "Random.hpp"
+#include <ostream>
+#include <span>
+
+/* Generators for synthetic puzzle inputs of arbitrary size. The scale multiplies the size of the real input
+ * in its natural dimension: the number of lines for lists, the side length for grids, the number of packets
+ * for Day 16 and so on. Every generated input satisfies the guarantees of the puzzle (a unique answer, every
+ * bingo board wins eventually, an odd number of incomplete lines, ...). */
+using GenerateInput = void (*)(Random& random, u32 scale, std::ostream& output);
+
+struct InputGenerator {
+    u32 day;
+    GenerateInput generate;
+};
+
+// all generators ordered by day
+[[nodiscard]] std::span<const InputGenerator> inputGenerators();
@@ -0,0 +1,50 @@
+#pragma once
+
+#include "AOCUtilities.hpp"
+#include <concepts>
+#include <random>
+#include <utility>
+
+/* Deterministic random numbers for the input generators. The output of std::mt19937_64 is fully specified
+ * by the standard, the std distributions and std::shuffle are not, so they are implemented here to generate
+ * the same inputs with every standard library. */
+class Random {
+public:
+    explicit Random(const u64 seed) : mEngine{ seed } { }
+
+    // uniformly distributed in [min, max] (ignoring the negligible modulo bias)
+    template<std::integral T>
+    [[nodiscard]] T between(const T min, const T max) {
+        const auto range = static_cast<u64>(max) - static_cast<u64>(min) + 1;
+        const auto offset = (range == 0 ? mEngine() : mEngine() % range);
+        return static_cast<T>(static_cast<u64>(min) + offset);
+    }
+
+    [[nodiscard]] bool chance(const double probability) {
+        return static_cast<double>(mEngine() >> 11) * 0x1.0p-53 < probability;
+    }
+
+    template<typename Container>
+    void shuffle(Container& values) {
+        for (auto i = values.size(); i > 1; --i) {
+            std::swap(values[i - 1], values[between(uz{ 0 }, i - 1)]);
+        }
+    }
+
+    template<typename Container>
+    [[nodiscard]] const auto& pick(const Container& container) {
+        return container[between(uz{ 0 }, container.size() - 1)];
+    }
+
+private:
+    std::mt19937_64 mEngine;
+};
+
+// derives independent seeds, so that generating only some of the inputs does not change them
+[[nodiscard]] constexpr u64 mixSeed(u64 seed, const u64 value) {
+    // splitmix64 finalizer
+    seed ^= value + 0x9e3779b97f4a7c15ULL + (seed << 6) + (seed >> 2);
+    seed = (seed ^ (seed >> 30)) * 0xbf58476d1ce4e5b9ULL;
+    seed = (seed ^ (seed >> 27)) * 0x94d049bb133111ebULL;
+    return seed ^ (seed >> 31);
+}
@@ -0,0 +1,100 @@
+#include "AOCUtilities.hpp"
+#include "Generators.hpp"
+#include "Random.hpp"
+#include <algorithm>
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include <string>
+#include <string_view>
+#include <vector>
+
+/* Writes synthetic inputs for the benchmark harness as <output>/dayNN.x<scale>.txt. The same seed always
+ * produces the same files, independent of which days and scales are generated together. */
+
+struct Options {
+    std::vector<u32> days;// all days with a generator if empty
+    std::vector<u32> scales{ 2, 4, 8 };
+    u64 seed{ 2021 };
+    std::string output{ "scaled-inputs" };
+};
+
+constexpr auto usage = std::string_view{
+    "Usage: aoc_generate [options]\n"
+    "  --days 1,5,9       only generate inputs for the given days (default: all)\n"
+    "  --scales 2,4,16    size relative to the real puzzle inputs (default: 2,4,8)\n"
+    "  --seed N           seed of the random numbers (default: 2021)\n"
+    "  --output DIR       target directory, - writes to stdout (default: scaled-inputs)\n"
+};
+
+[[nodiscard]] std::vector<u32> parseList(const std::string_view list) {
+    auto result = std::vector<u32>{};
+    appendIntegers(list, result);
+    return result;
+}
+
+[[nodiscard]] Options parseOptions(const int argc, char** const argv) {
+    auto options = Options{};
+    for (auto i = 1; i < argc; ++i) {
+        const auto argument = std::string_view{ argv[i] };
+        if (argument == "--help" || argument == "-h") {
+            std::cout << usage;
+            std::exit(0);
+        }
+        if (i + 1 >= argc) {
+            throw std::runtime_error{ "Missing value for option " + std::string{ argument } + ". " };
+        }
+        const auto value = std::string_view{ argv[++i] };
+        if (argument == "--days") {
+            options.days = parseList(value);
+        } else if (argument == "--scales") {
+            options.scales = parseList(value);
+        } else if (argument == "--seed") {
+            options.seed = parseInteger<u64>(value);
+        } else if (argument == "--output") {
+            options.output = value;
+        } else {
+            throw std::runtime_error{ "Unknown option " + std::string{ argument } + ". " };
+        }
+    }
+    if (std::find(options.scales.begin(), options.scales.end(), 0) != options.scales.end()) {
+        throw std::runtime_error{ "The scale has to be at least 1. " };
+    }
+    return options;
+}
+
+int main(const int argc, char** const argv) {
+    try {
+        const auto options = parseOptions(argc, argv);
+        const auto toStdout = (options.output == "-");
+        if (!toStdout) {
+            std::filesystem::create_directories(options.output);
+        }
+        for (const auto& generator : inputGenerators()) {
+            if (!options.days.empty() &&
+                std::find(options.days.begin(), options.days.end(), generator.day) == options.days.end()) {
+                continue;
+            }
+            for (const auto scale : options.scales) {
+                auto random = Random{ mixSeed(mixSeed(options.seed, generator.day), scale) };
+                if (toStdout) {
+                    generator.generate(random, scale, std::cout);
+                    continue;
+                }
+                const auto filename = "day" + std::string(generator.day < 10 ? "0" : "") +
+                                      std::to_string(generator.day) + ".x" + std::to_string(scale) + ".txt";
+                const auto path = std::filesystem::path{ options.output } / filename;
+                auto file = std::ofstream{ path, std::ios::binary };
+                if (!file) {
+                    throw std::runtime_error{ "Unable to open file. " };
+                }
+                generator.generate(random, scale, file);
+                file.close();
+                std::cout << path.string() << " (" << std::filesystem::file_size(path) << " bytes)\n";
+            }
+        }
+    } catch (const std::exception& exception) {
+        std::cerr << exception.what() << "\n" << usage;
+        return 1;
+    }
+}
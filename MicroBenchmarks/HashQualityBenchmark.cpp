@@ -0,0 +1,227 @@
+#include "AOCUtilities.hpp"
+#include "FlatPointMap.hpp"
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <cmath>
+#include <iomanip>
+#include <iostream>
+#include <random>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <unordered_set>
+#include <utility>
+#include <vector>
+
+/* Checks the hashers on the key distributions of the days: collisions in power of two sized bucket arrays
+ * (which is how FlatPointSet and most open addressing tables pick the bucket) compared to an ideal random
+ * hash, and the lookup speed in std::unordered_set and FlatPointSet. */
+
+using Clock = std::chrono::steady_clock;
+
+constexpr auto numRepetitions = 15;
+
+// keeps the compiler from optimizing away the benchmarked work
+volatile uz sink = 0;
+
+template<typename Function>
+[[nodiscard]] double medianNanoseconds(Function&& function) {
+    std::array<double, numRepetitions> timings{};
+    for (auto& timing : timings) {
+        const auto start = Clock::now();
+        sink = sink + function();
+        const auto end = Clock::now();
+        timing = std::chrono::duration<double, std::nano>(end - start).count();
+    }
+    std::nth_element(timings.begin(), timings.begin() + timings.size() / 2, timings.end());
+    return timings[timings.size() / 2];
+}
+
+// the hashes before the hashers were added: boost's hash_combine over the identity std::hash of the components
+template<typename Key>
+struct LegacyHasher {
+    [[nodiscard]] uz operator()(const Key& key) const {
+        auto combine = [](const uz seed, const auto value) {
+            return seed ^ (static_cast<uz>(value) + 0x9e3779b9 + (seed << 6) + (seed >> 2));
+        };
+        if constexpr (requires { key.first; }) {
+            if constexpr (sizeof(key.first) == 1) {
+                // Day 14 shifted the first character by sizeof(char), i.e. a single bit
+                return (static_cast<uz>(key.first) << sizeof(key.first)) + static_cast<uz>(key.second);
+            } else {
+                return combine(combine(0, key.first), key.second);
+            }
+        } else {
+            return combine(combine(0, key.x), key.y);
+        }
+    }
+};
+
+struct Quality {
+    uz numCollisions;
+    double expectedCollisions;
+    uz maxLoad;
+};
+
+// a key collides if its bucket is already taken, with n keys in m buckets an ideal hash has n - m(1 - e^(-n/m))
+template<typename Hasher, typename Key>
+[[nodiscard]] Quality measureQuality(const std::vector<Key>& keys) {
+    auto numBuckets = uz{ 1 };
+    while (numBuckets < keys.size()) {
+        numBuckets *= 2;
+    }
+    auto buckets = std::vector<u32>(numBuckets, 0);
+    auto quality = Quality{ 0, 0.0, 0 };
+    for (const auto& key : keys) {
+        auto& bucket = buckets[Hasher{}(key) & (numBuckets - 1)];
+        quality.numCollisions += (bucket > 0 ? 1 : 0);
+        quality.maxLoad = std::max(quality.maxLoad, static_cast<uz>(++bucket));
+    }
+    const auto n = static_cast<double>(keys.size());
+    const auto m = static_cast<double>(numBuckets);
+    quality.expectedCollisions = n - m * (1.0 - std::exp(-n / m));
+    return quality;
+}
+
+template<typename Set, typename Key>
+[[nodiscard]] double lookupNanoseconds(const std::vector<Key>& keys, const std::vector<Key>& lookups) {
+    auto set = Set{};
+    for (const auto& key : keys) {
+        set.insert(key);
+    }
+    return medianNanoseconds([&]() {
+               auto numFound = uz{ 0 };
+               for (const auto& key : lookups) {
+                   numFound += (set.contains(key) ? 1 : 0);
+               }
+               return numFound;
+           }) /
+           static_cast<double>(lookups.size());
+}
+
+template<typename Hasher, typename Key>
+void reportHasher(const std::string_view name, const std::vector<Key>& keys, const std::vector<Key>& lookups) {
+    const auto quality = measureQuality<Hasher>(keys);
+    std::cout << "  " << std::left << std::setw(10) << name << std::right << std::setw(10) << quality.numCollisions
+              << std::setw(12) << std::fixed << std::setprecision(0) << quality.expectedCollisions << std::setw(9)
+              << quality.maxLoad << std::setw(12) << std::setprecision(2)
+              << lookupNanoseconds<std::unordered_set<Key, Hasher>>(keys, lookups) << std::setw(12);
+    // FlatPointSet only takes trivially copyable keys, std::pair is not
+    if constexpr (std::is_trivially_copyable_v<Key>) {
+        std::cout << lookupNanoseconds<FlatPointSet<Key, Hasher>>(keys, lookups) << "\n";
+    } else {
+        std::cout << "-\n";
+    }
+}
+
+// half of the lookups hit, the other half are drawn from the same distribution and mostly miss
+template<typename Key>
+void reportDistribution(const std::string_view name, std::vector<Key> keys, std::vector<Key> misses,
+                        std::mt19937& generator) {
+    auto unique = std::unordered_set<Key, Murmur3Hasher<Key>>{};
+    std::erase_if(keys, [&](const Key& key) { return !unique.insert(key).second; });
+    std::shuffle(keys.begin(), keys.end(), generator);
+    auto lookups = std::vector<Key>{};
+    for (auto i = uz{ 0 }; i < keys.size(); ++i) {
+        lookups.push_back(i % 2 == 0 || misses.empty() ? keys[i] : misses[i % misses.size()]);
+    }
+    std::cout << name << " (" << keys.size() << " keys)\n"
+              << "  " << std::left << std::setw(10) << "hasher" << std::right << std::setw(10) << "collisions"
+              << std::setw(12) << "ideal" << std::setw(9) << "max load" << std::setw(12) << "std ns/op"
+              << std::setw(12) << "flat ns/op\n";
+    reportHasher<LegacyHasher<Key>>("legacy", keys, lookups);
+    reportHasher<Murmur3Hasher<Key>>("murmur3", keys, lookups);
+    reportHasher<WyHasher<Key>>("wyhash", keys, lookups);
+}
+
+int main() {
+    auto generator = std::mt19937{ 42 };
+
+    // Day 05: horizontal and vertical segments in a 1000x1000 field
+    {
+        auto coordinate = std::uniform_int_distribution<u32>{ 0, 999 };
+        auto points = std::vector<PointU32>{};
+        for (auto i = 0; i < 500; ++i) {
+            const auto x = coordinate(generator);
+            const auto y = coordinate(generator);
+            const auto length = std::min(coordinate(generator) / 2, 999 - std::max(x, y));
+            for (auto step = u32{ 0 }; step <= length; ++step) {
+                points.push_back(i % 2 == 0 ? PointU32{ x + step, y } : PointU32{ x, y + step });
+            }
+        }
+        auto misses = std::vector<PointU32>{};
+        for (auto i = 0; i < 1000; ++i) {
+            misses.push_back(PointU32{ coordinate(generator), coordinate(generator) });
+        }
+        reportDistribution("Day 05 segment points", points, misses, generator);
+    }
+
+    // Day 09/15: every point of a full grid
+    for (const auto size : { uz{ 100 }, uz{ 500 } }) {
+        auto points = std::vector<PointUZ>{};
+        for (auto y = uz{ 0 }; y < size; ++y) {
+            for (auto x = uz{ 0 }; x < size; ++x) {
+                points.push_back(PointUZ{ x, y });
+            }
+        }
+        auto misses = std::vector<PointUZ>{};
+        for (auto i = uz{ 0 }; i < size; ++i) {
+            misses.push_back(PointUZ{ size + i, i });
+        }
+        reportDistribution("Day 09/15 " + std::to_string(size) + "x" + std::to_string(size) + " grid", points,
+                           misses, generator);
+    }
+
+    // Day 13: sparse dots on the transparent paper
+    {
+        auto x = std::uniform_int_distribution<u32>{ 0, 1310 };
+        auto y = std::uniform_int_distribution<u32>{ 0, 894 };
+        auto dots = std::vector<PointU32>{};
+        auto misses = std::vector<PointU32>{};
+        for (auto i = 0; i < 1000; ++i) {
+            dots.push_back(PointU32{ x(generator), y(generator) });
+            misses.push_back(PointU32{ x(generator), y(generator) });
+        }
+        reportDistribution("Day 13 sparse dots", dots, misses, generator);
+    }
+
+    // Day 14: pairs of the polymer's elements
+    {
+        constexpr auto elements = std::string_view{ "BCFHKNOPSV" };
+        auto pairs = std::vector<std::pair<char, char>>{};
+        for (const auto first : elements) {
+            for (const auto second : elements) {
+                pairs.emplace_back(first, second);
+            }
+        }
+        reportDistribution("Day 14 element pairs", pairs, {}, generator);
+    }
+
+    // Day 19: pairs of scanner indices
+    {
+        auto pairs = std::vector<std::pair<i64, i64>>{};
+        auto misses = std::vector<std::pair<i64, i64>>{};
+        for (auto i = i64{ 0 }; i < 200; ++i) {
+            for (auto j = i + 1; j < 200; ++j) {
+                pairs.emplace_back(i, j);
+                misses.emplace_back(j, i);
+            }
+        }
+        reportDistribution("Day 19 scanner pairs", pairs, misses, generator);
+    }
+
+    // Day 20: light pixels of the image grown to both sides of the origin
+    {
+        constexpr auto imageSize = 400;
+        auto coin = std::bernoulli_distribution{ 0.5 };
+        auto pixels = std::vector<PointI32>{};
+        auto misses = std::vector<PointI32>{};
+        for (auto y = -imageSize / 2; y < imageSize / 2; ++y) {
+            for (auto x = -imageSize / 2; x < imageSize / 2; ++x) {
+                (coin(generator) ? pixels : misses).push_back(PointI32{ x, y });
+            }
+        }
+        reportDistribution("Day 20 image pixels", pixels, misses, generator);
+    }
+}
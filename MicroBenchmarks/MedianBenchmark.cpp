@@ -0,0 +1,106 @@
+#include "AOCUtilities.hpp"
+#include "Median.hpp"
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <cmath>
+#include <iomanip>
+#include <iostream>
+#include <random>
+#include <string>
+#include <string_view>
+#include <vector>
+
+// compares the ways to get the median of Day 10-like completion scores at growing sizes
+
+using Clock = std::chrono::steady_clock;
+
+constexpr auto numRepetitions = 15;
+
+// keeps the compiler from optimizing away the benchmarked work
+volatile uz sink = 0;
+
+template<typename Function>
+[[nodiscard]] double medianNanoseconds(Function&& function) {
+    std::array<double, numRepetitions> timings{};
+    for (auto& timing : timings) {
+        const auto start = Clock::now();
+        sink = sink + function();
+        const auto end = Clock::now();
+        timing = std::chrono::duration<double, std::nano>(end - start).count();
+    }
+    std::nth_element(timings.begin(), timings.begin() + timings.size() / 2, timings.end());
+    return timings[timings.size() / 2];
+}
+
+void report(const std::string_view name, const uz numOperations, const double nanoseconds) {
+    std::cout << std::left << std::setw(52) << name << std::right << std::setw(12) << std::fixed
+              << std::setprecision(1) << (nanoseconds / 1000.0) << " us" << std::setw(10) << std::setprecision(2)
+              << (nanoseconds / static_cast<double>(numOperations)) << " ns/value\n";
+}
+
+// the previous median(): partial_sort of the lower half for an even number of values
+[[nodiscard]] u64 partialSortMedian(std::vector<u64>& values) {
+    const auto middle = values.begin() + static_cast<std::ptrdiff_t>(values.size() / 2);
+    std::partial_sort(values.begin(), middle, values.end());
+    return (*middle + *(middle - 1)) / 2;
+}
+
+int main() {
+    auto generator = std::mt19937_64{ 42 };
+    // completion scores grow by a factor of 5 per missing character
+    auto numMissing = std::uniform_int_distribution<int>{ 1, 20 };
+
+    for (const auto size : { uz{ 1'000 }, uz{ 100'000 }, uz{ 2'000'000 } }) {
+        auto scores = std::vector<u64>{};
+        for (auto i = uz{ 0 }; i < size; ++i) {
+            const auto maxScore = static_cast<u64>(std::pow(5.0, numMissing(generator)));
+            scores.push_back(std::uniform_int_distribution<u64>{ 1, maxScore }(generator));
+        }
+        const auto prefix = std::to_string(size) + " values: ";
+
+        // every selection works on a fresh copy, copying is measured on its own
+        auto copy = std::vector<u64>{};
+        const auto copyNanoseconds = medianNanoseconds([&]() {
+            copy = scores;
+            return copy.size();
+        });
+        const auto selectNanoseconds = [&](auto&& select) {
+            return medianNanoseconds([&]() {
+                       copy = scores;
+                       return static_cast<uz>(select(copy));
+                   }) -
+                   copyNanoseconds;
+        };
+        const auto exact = [&]() {
+            copy = scores;
+            return median(copy);
+        }();
+
+        report(prefix + "partial_sort median (previous)", size, selectNanoseconds(partialSortMedian));
+        report(prefix + "median()", size, selectNanoseconds([](auto& values) { return median(values); }));
+        report(prefix + "parallelMedian()", size,
+               selectNanoseconds([](auto& values) { return parallelMedian(values); }));
+        report(prefix + "StreamingMedian", size, medianNanoseconds([&]() {
+                   auto streamingMedian = StreamingMedian<u64>{};
+                   for (const auto score : scores) {
+                       streamingMedian.push(score);
+                   }
+                   return static_cast<uz>(streamingMedian.median() == exact);
+               }));
+        auto approximation = 0.0;
+        report(prefix + "ApproximateMedian (P2)", size, medianNanoseconds([&]() {
+                   auto approximateMedian = ApproximateMedian{};
+                   for (const auto score : scores) {
+                       approximateMedian.push(static_cast<double>(score));
+                   }
+                   approximation = approximateMedian.median();
+                   return approximateMedian.size();
+               }));
+        const auto rank = std::count_if(scores.begin(), scores.end(),
+                                        [&](const u64 score) { return static_cast<double>(score) < approximation; });
+        std::cout << "  P2 estimate " << std::setprecision(0) << approximation << " vs. exact " << exact
+                  << ", rank " << std::setprecision(4)
+                  << 100.0 * static_cast<double>(rank) / static_cast<double>(size) << "%\n";
+    }
+}
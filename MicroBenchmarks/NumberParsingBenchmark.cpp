@@ -0,0 +1,89 @@
+#include "AOCUtilities.hpp"
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <iomanip>
+#include <iostream>
+#include <random>
+#include <string>
+#include <string_view>
+#include <vector>
+
+// compares std::stoi on split() tokens against the bulk integer parsing of the utilities
+
+using Clock = std::chrono::steady_clock;
+
+constexpr auto numRepetitions = 15;
+
+// keeps the compiler from optimizing away the benchmarked work
+volatile i64 sink = 0;
+
+template<typename Function>
+[[nodiscard]] double medianNanoseconds(Function&& function) {
+    std::array<double, numRepetitions> timings{};
+    for (auto& timing : timings) {
+        const auto start = Clock::now();
+        sink = sink + function();
+        const auto end = Clock::now();
+        timing = std::chrono::duration<double, std::nano>(end - start).count();
+    }
+    std::nth_element(timings.begin(), timings.begin() + timings.size() / 2, timings.end());
+    return timings[timings.size() / 2];
+}
+
+void report(const std::string_view name, const uz numIntegers, const double nanoseconds) {
+    std::cout << std::left << std::setw(44) << name << std::right << std::setw(12) << std::fixed
+              << std::setprecision(1) << (nanoseconds / 1000.0) << " us" << std::setw(10) << std::setprecision(2)
+              << (nanoseconds / static_cast<double>(numIntegers)) << " ns/integer\n";
+}
+
+[[nodiscard]] std::string integerList(std::mt19937& generator, const uz count, const i64 min, const i64 max,
+                                      const std::string_view separator) {
+    auto distribution = std::uniform_int_distribution<i64>{ min, max };
+    auto result = std::string{};
+    for (auto i = uz{ 0 }; i < count; ++i) {
+        if (i != 0) {
+            result += separator;
+        }
+        result += std::to_string(distribution(generator));
+    }
+    return result;
+}
+
+void compare(const std::string_view name, const std::string& input, const char delimiter, const uz count) {
+    report(std::string{ name } + ": split() + std::stoll", count, medianNanoseconds([&]() {
+               auto sum = i64{ 0 };
+               for (const auto& token : split(input, delimiter)) {
+                   sum += std::stoll(token);
+               }
+               return sum;
+           }));
+    report(std::string{ name } + ": splitView() + std::from_chars", count, medianNanoseconds([&]() {
+               auto sum = i64{ 0 };
+               for (const auto token : splitView(input, delimiter)) {
+                   auto value = i64{};
+                   std::from_chars(token.data(), token.data() + token.size(), value);
+                   sum += value;
+               }
+               return sum;
+           }));
+    auto output = std::vector<i64>(count);
+    report(std::string{ name } + ": parseIntegers()", count, medianNanoseconds([&]() {
+               parseIntegers(input, std::span{ output });
+               return output.back();
+           }));
+}
+
+int main() {
+    auto generator = std::mt19937{ 42 };
+    constexpr auto count = uz{ 1'000'000 };
+
+    // Day 06/07 style: small non-negative numbers in one comma-separated line
+    compare("small", integerList(generator, count, 0, 1999, ","), ',', count);
+
+    // Day 19 style: signed coordinates
+    compare("signed", integerList(generator, count, -999, 999, ","), ',', count);
+
+    // long numbers that take the std::from_chars path
+    compare("large", integerList(generator, count, 0, 1'000'000'000'000, " "), ' ', count);
+}
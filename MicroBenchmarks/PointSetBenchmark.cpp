@@ -0,0 +1,150 @@
+#include "AOCUtilities.hpp"
+#include "FlatPointMap.hpp"
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <iomanip>
+#include <iostream>
+#include <random>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+// compares the node-based std containers against FlatPointSet/FlatPointMap for the access patterns of the days
+
+using Clock = std::chrono::steady_clock;
+
+constexpr auto numRepetitions = 15;
+
+// keeps the compiler from optimizing away the benchmarked work
+volatile uz sink = 0;
+
+template<typename Function>
+[[nodiscard]] double medianNanoseconds(Function&& function) {
+    std::array<double, numRepetitions> timings{};
+    for (auto& timing : timings) {
+        const auto start = Clock::now();
+        sink = sink + function();
+        const auto end = Clock::now();
+        timing = std::chrono::duration<double, std::nano>(end - start).count();
+    }
+    std::nth_element(timings.begin(), timings.begin() + timings.size() / 2, timings.end());
+    return timings[timings.size() / 2];
+}
+
+void report(const std::string_view name, const uz numOperations, const double nanoseconds) {
+    std::cout << std::left << std::setw(52) << name << std::right << std::setw(12) << std::fixed
+              << std::setprecision(1) << (nanoseconds / 1000.0) << " us" << std::setw(10) << std::setprecision(2)
+              << (nanoseconds / static_cast<double>(numOperations)) << " ns/operation\n";
+}
+
+// Day 05: counting how often every point of a set of lines is covered
+template<typename Map>
+void benchmarkCounting(const std::string_view name, const std::vector<PointU32>& points) {
+    report(std::string{ name } + ": count overlaps", points.size(), medianNanoseconds([&]() {
+               auto tiles = Map{};
+               for (const auto& point : points) {
+                   ++tiles[point];
+               }
+               return static_cast<uz>(std::count_if(tiles.begin(), tiles.end(), [](const auto& tile) {
+                   return tile.second >= 2;
+               }));
+           }));
+}
+
+// Day 20: inserting a dense image and looking up the 3x3 neighborhood of every pixel around it
+template<typename Set>
+void benchmarkImage(const std::string_view name, const std::vector<PointI32>& lightPixels, const i32 size) {
+    report(std::string{ name } + ": insert image", lightPixels.size(), medianNanoseconds([&]() {
+               auto image = Set{};
+               for (const auto& pixel : lightPixels) {
+                   image.insert(pixel);
+               }
+               return image.size();
+           }));
+    auto image = Set{};
+    for (const auto& pixel : lightPixels) {
+        image.insert(pixel);
+    }
+    const auto numLookups = static_cast<uz>((size + 2) * (size + 2) * 9);
+    report(std::string{ name } + ": 3x3 neighborhood lookups", numLookups, medianNanoseconds([&]() {
+               auto numLight = uz{ 0 };
+               for (auto y = -1; y <= size; ++y) {
+                   for (auto x = -1; x <= size; ++x) {
+                       for (auto j = -1; j <= 1; ++j) {
+                           for (auto i = -1; i <= 1; ++i) {
+                               numLight += (image.contains(PointI32{ x + i, y + j }) ? 1 : 0);
+                           }
+                       }
+                   }
+               }
+               return numLight;
+           }));
+}
+
+// Day 09/13: sparse random points, half of the lookups miss
+template<typename Set>
+void benchmarkRandom(const std::string_view name, const std::vector<PointUZ>& points, const std::vector<PointUZ>& lookups) {
+    report(std::string{ name } + ": insert random points", points.size(), medianNanoseconds([&]() {
+               auto set = Set{};
+               for (const auto& point : points) {
+                   set.insert(point);
+               }
+               return set.size();
+           }));
+    auto set = Set{};
+    for (const auto& point : points) {
+        set.insert(point);
+    }
+    report(std::string{ name } + ": random lookups (50% hits)", lookups.size(), medianNanoseconds([&]() {
+               auto numFound = uz{ 0 };
+               for (const auto& point : lookups) {
+                   numFound += (set.contains(point) ? 1 : 0);
+               }
+               return numFound;
+           }));
+}
+
+int main() {
+    auto generator = std::mt19937{ 42 };
+
+    auto linePoints = std::vector<PointU32>{};
+    auto coordinate = std::uniform_int_distribution<u32>{ 0, 999 };
+    for (auto i = 0; i < 2000; ++i) {
+        const auto x = coordinate(generator);
+        const auto y = coordinate(generator);
+        const auto length = std::min(coordinate(generator) / 2, 999 - std::max(x, y));
+        const auto horizontal = (i % 2 == 0);
+        for (auto step = u32{ 0 }; step <= length; ++step) {
+            linePoints.push_back(horizontal ? PointU32{ x + step, y } : PointU32{ x, y + step });
+        }
+    }
+    benchmarkCounting<std::unordered_map<PointU32, u32>>("std::unordered_map", linePoints);
+    benchmarkCounting<FlatPointMap<PointU32, u32>>("FlatPointMap", linePoints);
+
+    constexpr auto imageSize = 400;
+    auto lightPixels = std::vector<PointI32>{};
+    auto coin = std::bernoulli_distribution{ 0.5 };
+    for (auto y = 0; y < imageSize; ++y) {
+        for (auto x = 0; x < imageSize; ++x) {
+            if (coin(generator)) {
+                lightPixels.push_back(PointI32{ x, y });
+            }
+        }
+    }
+    benchmarkImage<std::unordered_set<PointI32>>("std::unordered_set", lightPixels, imageSize);
+    benchmarkImage<FlatPointSet<PointI32>>("FlatPointSet", lightPixels, imageSize);
+
+    auto randomCoordinate = std::uniform_int_distribution<uz>{ 0, 1'000'000 };
+    auto randomPoints = std::vector<PointUZ>{};
+    auto lookups = std::vector<PointUZ>{};
+    for (auto i = 0; i < 200'000; ++i) {
+        randomPoints.push_back(PointUZ{ randomCoordinate(generator), randomCoordinate(generator) });
+        lookups.push_back(i % 2 == 0 ? randomPoints.back()
+                                     : PointUZ{ randomCoordinate(generator), randomCoordinate(generator) });
+    }
+    benchmarkRandom<std::unordered_set<PointUZ>>("std::unordered_set", randomPoints, lookups);
+    benchmarkRandom<FlatPointSet<PointUZ>>("FlatPointSet", randomPoints, lookups);
+}
@@ -0,0 +1,140 @@
+#include "AOCUtilities.hpp"
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <iomanip>
+#include <iostream>
+#include <random>
+#include <string>
+#include <string_view>
+#include <vector>
+
+// compares split()/trim() against their view-based counterparts on inputs shaped like the real puzzle inputs
+
+using Clock = std::chrono::steady_clock;
+
+constexpr auto numRepetitions = 15;
+
+// keeps the compiler from optimizing away the benchmarked work
+volatile uz sink = 0;
+
+template<typename Function>
+[[nodiscard]] double medianNanoseconds(Function&& function) {
+    std::array<double, numRepetitions> timings{};
+    for (auto& timing : timings) {
+        const auto start = Clock::now();
+        sink = sink + function();
+        const auto end = Clock::now();
+        timing = std::chrono::duration<double, std::nano>(end - start).count();
+    }
+    std::nth_element(timings.begin(), timings.begin() + timings.size() / 2, timings.end());
+    return timings[timings.size() / 2];
+}
+
+void report(const std::string_view name, const uz numBytes, const double nanoseconds) {
+    std::cout << std::left << std::setw(44) << name << std::right << std::setw(12) << std::fixed
+              << std::setprecision(1) << (nanoseconds / 1000.0) << " us" << std::setw(10) << std::setprecision(3)
+              << (static_cast<double>(numBytes) / nanoseconds) << " GB/s\n";
+}
+
+[[nodiscard]] std::string commaSeparatedNumbers(std::mt19937& generator, const uz count) {
+    auto distribution = std::uniform_int_distribution<u32>{ 0, 1999 };
+    auto result = std::string{};
+    for (auto i = uz{ 0 }; i < count; ++i) {
+        if (i != 0) {
+            result += ',';
+        }
+        result += std::to_string(distribution(generator));
+    }
+    return result;
+}
+
+[[nodiscard]] std::vector<std::string> bingoRows(std::mt19937& generator, const uz count) {
+    auto distribution = std::uniform_int_distribution<u32>{ 0, 99 };
+    auto result = std::vector<std::string>{};
+    result.reserve(count);
+    for (auto i = uz{ 0 }; i < count; ++i) {
+        auto row = std::string{};
+        for (auto column = 0; column < 5; ++column) {
+            const auto number = std::to_string(distribution(generator));
+            row += std::string(3 - number.length(), ' ') + number;
+        }
+        result.push_back(std::move(row));
+    }
+    return result;
+}
+
+[[nodiscard]] std::string longLine(std::mt19937& generator, const uz length, const char delimiter) {
+    auto distribution = std::uniform_int_distribution<int>{ 'a', 'z' };
+    auto result = std::string(length, ' ');
+    std::generate(result.begin(), result.end(), [&]() { return static_cast<char>(distribution(generator)); });
+    result.back() = delimiter;
+    return result;
+}
+
+int main() {
+    auto generator = std::mt19937{ 42 };
+
+    // Day 06/07: one huge comma-separated line
+    const auto numbers = commaSeparatedNumbers(generator, 1'000'000);
+    report("split() comma list", numbers.size(), medianNanoseconds([&]() { return split(numbers, ',').size(); }));
+    report("splitView() comma list", numbers.size(), medianNanoseconds([&]() {
+               auto count = uz{ 0 };
+               for (const auto token : splitView(numbers, ',')) {
+                   count += token.size();
+               }
+               return count;
+           }));
+
+    // Day 04: lots of short, space-padded lines
+    const auto rows = bingoRows(generator, 200'000);
+    const auto rowBytes = rows.size() * rows.front().size();
+    report("split() bingo rows", rowBytes, medianNanoseconds([&]() {
+               auto count = uz{ 0 };
+               for (const auto& row : rows) {
+                   count += split(row).size();
+               }
+               return count;
+           }));
+    report("splitInto() bingo rows", rowBytes, medianNanoseconds([&]() {
+               auto count = uz{ 0 };
+               auto tokens = std::array<std::string_view, 5>{};
+               for (const auto& row : rows) {
+                   count += splitInto(row, tokens);
+               }
+               return count;
+           }));
+
+    // Day 08: trimming the tokens of a line
+    report("trim() bingo rows", rowBytes, medianNanoseconds([&]() {
+               auto count = uz{ 0 };
+               for (const auto& row : rows) {
+                   count += trim(row).size();
+               }
+               return count;
+           }));
+    report("trimView() bingo rows", rowBytes, medianNanoseconds([&]() {
+               auto count = uz{ 0 };
+               for (const auto& row : rows) {
+                   count += trimView(row).size();
+               }
+               return count;
+           }));
+
+    // raw delimiter scanning over a long token
+    const auto line = longLine(generator, 64 * 1024 * 1024, '|');
+    report("naive loop delimiter scan", line.size(), medianNanoseconds([&]() {
+               auto iterator = line.data();
+               while (iterator != line.data() + line.size() && *iterator != '|') {
+                   ++iterator;
+               }
+               return static_cast<uz>(iterator - line.data());
+           }));
+    report("std::memchr delimiter scan", line.size(), medianNanoseconds([&]() {
+               const auto result = static_cast<const char*>(std::memchr(line.data(), '|', line.size()));
+               return static_cast<uz>(result - line.data());
+           }));
+    report("findChar() delimiter scan", line.size(), medianNanoseconds([&]() {
+               return static_cast<uz>(findChar(line.data(), line.data() + line.size(), '|') - line.data());
+           }));
+}
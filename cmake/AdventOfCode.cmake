@@ -0,0 +1,106 @@
+# Shared build settings for every puzzle. Included by the top-level project as well as by every
+# AdventOfCodeNN/CMakeLists.txt, so the days can still be opened and built on their own.
+include_guard(GLOBAL)
+
+set(CMAKE_CXX_STANDARD 23)
+set(CMAKE_CXX_STANDARD_REQUIRED ON)
+
+if (NOT CMAKE_BUILD_TYPE AND NOT CMAKE_CONFIGURATION_TYPES)
+    set(CMAKE_BUILD_TYPE Release CACHE STRING "Choose the type of build." FORCE)
+endif ()
+
+option(AOC_ENABLE_LTO "Use link-time optimization for Release and RelWithDebInfo builds" ON)
+option(AOC_ENABLE_TRACING "Record the AOC_TRACE_ZONE zones and write them as Chrome trace JSON on exit" OFF)
+# The binaries run on every CPU of the architecture by default, the vectorized kernels pick the instructions of the
+# machine at runtime (AOCUtilities/CpuDispatch.hpp). Setting e.g. AOC_MARCH=native trades that for code tuned to
+# the building machine everywhere else.
+set(AOC_MARCH "" CACHE STRING "Target architecture passed to -march= for optimized builds (empty to disable)")
+set(AOC_MSVC_ARCH "" CACHE STRING "Target architecture passed to /arch: for optimized builds (empty to disable)")
+
+if (AOC_ENABLE_LTO)
+    include(CheckIPOSupported)
+    check_ipo_supported(RESULT AOC_LTO_SUPPORTED OUTPUT AOC_LTO_ERROR LANGUAGES CXX)
+    if (NOT AOC_LTO_SUPPORTED)
+        message(WARNING "Link-time optimization is not supported: ${AOC_LTO_ERROR}")
+    endif ()
+endif ()
+
+# applies the optimization settings that every target of the project shares
+function(aoc_configure_target target)
+    set(optimized "$<CONFIG:Release,RelWithDebInfo>")
+    if (MSVC)
+        target_compile_options(${target} PRIVATE "$<${optimized}:/O2>" "$<${optimized}:/Oi>")
+        if (AOC_MSVC_ARCH)
+            target_compile_options(${target} PRIVATE "$<${optimized}:/arch:${AOC_MSVC_ARCH}>")
+        endif ()
+    else ()
+        target_compile_options(${target} PRIVATE "$<${optimized}:-O3>")
+        if (AOC_MARCH)
+            target_compile_options(${target} PRIVATE "$<${optimized}:-march=${AOC_MARCH}>")
+        endif ()
+    endif ()
+    if (AOC_ENABLE_LTO AND AOC_LTO_SUPPORTED)
+        set_target_properties(${target} PROPERTIES
+                              INTERPROCEDURAL_OPTIMIZATION_RELEASE ON
+                              INTERPROCEDURAL_OPTIMIZATION_RELWITHDEBINFO ON)
+    endif ()
+endfunction()
+
+function(aoc_add_executable target)
+    add_executable(${target} ${ARGN})
+    target_link_libraries(${target} PRIVATE aoc_utils)
+    aoc_configure_target(${target})
+endfunction()
+
+# Adds the solver of a day as the object library dayNN (so its PuzzleRegistration is never dropped by the
+# linker) and the executable AdventOfCodeNN that runs it from main.cpp.
+function(aoc_add_day day)
+    add_library(day${day} OBJECT ${ARGN})
+    target_link_libraries(day${day} PUBLIC aoc_utils)
+    target_include_directories(day${day} PUBLIC ${CMAKE_CURRENT_SOURCE_DIR})
+    aoc_configure_target(day${day})
+    aoc_add_executable(AdventOfCode${day} main.cpp)
+    target_link_libraries(AdventOfCode${day} PRIVATE day${day})
+endfunction()
+
+# Embeds a file of the day (usually input.txt) into the generated header DayNNInput.hpp as
+#     namespace dayNN::embedded { inline constexpr std::string_view input; }
+# so the constexpr string utilities of AOCUtilities.hpp can parse it, and the day can solve it, at compile time.
+# The header is written when the project is configured, which happens again whenever the file changes.
+function(aoc_embed_input day file)
+    set(source ${CMAKE_CURRENT_SOURCE_DIR}/${file})
+    file(READ ${source} bytes HEX)
+    string(LENGTH "${bytes}" numHexDigits)
+    math(EXPR numBytes "${numHexDigits} / 2")
+    # every byte as a character literal, 12 of them per line (CMake regular expressions have no {n})
+    string(REGEX REPLACE "([0-9a-f][0-9a-f])" "'\\\\x\\1'," bytes "${bytes}")
+    string(REPEAT "'[^']+'," 12 line)
+    string(REGEX REPLACE "(${line})" "\\1\n            " bytes "${bytes}")
+    string(REPLACE ",'" ", '" bytes "${bytes}")
+    string(STRIP "${bytes}" bytes)
+    file(CONFIGURE OUTPUT ${CMAKE_CURRENT_BINARY_DIR}/embedded/Day${day}Input.hpp
+         CONTENT [[// Generated by aoc_embed_input() from @source@, do not edit.
+#pragma once
+
+#include <array>
+#include <string_view>
+
+namespace day@day@::embedded {
+    inline constexpr auto inputData = std::array<char, @numBytes@>{
+            @bytes@
+    };
+    inline constexpr auto input = std::string_view{ inputData.data(), inputData.size() };
+}// namespace day@day@::embedded
+]] @ONLY)
+    set_property(DIRECTORY APPEND PROPERTY CMAKE_CONFIGURE_DEPENDS ${source})
+    target_include_directories(day${day} PUBLIC ${CMAKE_CURRENT_BINARY_DIR}/embedded)
+    # solving a puzzle in a constant expression takes far more steps than the compilers allow by default
+    target_compile_options(day${day} PRIVATE
+                           "$<$<CXX_COMPILER_ID:GNU>:-fconstexpr-ops-limit=1000000000>"
+                           "$<$<CXX_COMPILER_ID:Clang,AppleClang>:-fconstexpr-steps=1000000000>"
+                           "$<$<CXX_COMPILER_ID:MSVC>:/constexpr:steps1000000000>")
+endfunction()
+
+if (NOT TARGET aoc_utils)
+    add_subdirectory(${CMAKE_CURRENT_LIST_DIR}/../AOCUtilities ${CMAKE_BINARY_DIR}/AOCUtilities)
+endif ()